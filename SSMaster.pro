@@ -15,6 +15,10 @@ QMAKE_CXXFLAGS_RELEASE -= -O2
 # add the desired -O3 if not present
 QMAKE_CXXFLAGS_RELEASE += -O3
 
+# Uncomment the following line to turn the cube with SSSE3 bytes shuffles (x86-64 CPUs from 2006 onwards)
+# Without it (or with GRCUBE3_NO_SIMD defined) the portable bitfield turns are used
+#QMAKE_CXXFLAGS_RELEASE += -mssse3
+
 # The following define makes your compiler emit warnings if you use
 # any Qt feature that has been marked deprecated (the exact warnings
 # depend on your compiler). Please consult the documentation of the
@@ -26,14 +30,21 @@ DEFINES += QT_DEPRECATED_WARNINGS
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Uncomment the following line to collect search statistics (nodes, checks, solves... per level and thread)
+# and add them to the time reports. Without it the statistics code is not compiled
+#DEFINES += GRCUBE3_SEARCH_STATS
+
 SOURCES += \
     algorithm.cpp \
     algset.cpp \
     ceor.cpp \
     cfop.cpp \
     collection.cpp \
+    coordinates.cpp \
     corners.cpp \
     cube.cpp \
+    cube_batch.cpp \
+    cube_delta.cpp \
     deep_eval.cpp \
     deep_search.cpp \
     edges.cpp \
@@ -45,19 +56,26 @@ SOURCES += \
     method.cpp \
     nautilus.cpp \
     petrus.cpp \
+    pruning.cpp \
     roux.cpp \
+    search_stats.cpp \
     searchthread.cpp \
+    symmetry.cpp \
     tinyxml2.cpp \
     zz.cpp
 
 HEADERS += \
     algorithm.h \
     algset.h \
+    budget.h \
     ceor.h \
     cfop.h \
     collection.h \
+    coordinates.h \
     corners.h \
     cube.h \
+    cube_batch.h \
+    cube_delta.h \
     cube_definitions.h \
     deep_eval.h \
     deep_search.h \
@@ -69,8 +87,12 @@ HEADERS += \
     method.h \
     nautilus.h \
     petrus.h \
+    pruning.h \
     roux.h \
+    search_stats.h \
+    scheduler.h \
     searchthread.h \
+    symmetry.h \
     tinyxml2.h \
     zz.h
 
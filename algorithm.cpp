@@ -21,6 +21,10 @@
 */
 
 #include <random>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #include "algorithm.h"
 #include "tinyxml2.h"
@@ -31,6 +35,8 @@ namespace grcube3
 {
     const std::vector<Algorithm> Algorithm::Cancellations2 = LoadXMLCancellationsFile("algsets/cancel2.xml"); // Load two steps cancellations
     const std::vector<Algorithm> Algorithm::Cancellations3 = LoadXMLCancellationsFile("algsets/cancel3.xml"); // Load three steps cancellations
+    const std::vector<uint16_t> Algorithm::CancellationsIndex2 = GetCancellationsIndex(Cancellations2, 2u); // Two steps cancellations index
+    const std::vector<uint16_t> Algorithm::CancellationsIndex3 = GetCancellationsIndex(Cancellations3, 3u); // Three steps cancellations index
 
 	// Array with subjective score for each movement (0 = No influence or very pleasant movement, 10 = very annoying movement)
 	const uint Algorithm::m_scores[]
@@ -1076,7 +1082,7 @@ namespace grcube3
 	};
 	
 	// Array with steps string representation
-	const std::string Algorithm::m_strings[]
+	const char Algorithm::m_strings[][3]
 	{
 		"", // No movement
 	
@@ -1109,6 +1115,53 @@ namespace grcube3
 		// Parentheses --limited to a maximum of 9 repetitions--
 		"(", ")", ")2", ")3", ")4", ")5", ")6", ")7", ")8", ")9"
 	};
+
+	// Array with the five bits code for each step in the packed encoding (the usual steps in the solves)
+	const uint8_t Algorithm::m_packed_codes[]
+	{
+		PACKED_ESCAPE, // No movement
+
+		// Single layer
+		1u, 2u, 3u,
+		4u, 5u, 6u,
+		7u, 8u, 9u,
+		10u, 11u, 12u,
+		13u, 14u, 15u,
+		16u, 17u, 18u,
+
+		// Double layer
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		19u, 20u, 21u,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+
+		// Middle layers
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		22u, 23u, 24u,
+
+		// Full cube
+		25u, 26u, 27u,
+		28u, 29u, 30u,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+
+		// Parentheses
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE,
+		PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE, PACKED_ESCAPE
+	};
+
+	// Array with the step for each five bits code in the packed encoding (code 0 is the end of the steps)
+	const Stp Algorithm::m_packed_steps[]
+	{
+		Stp::NONE,
+		Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::F, Stp::Fp, Stp::F2,
+		Stp::B, Stp::Bp, Stp::B2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2,
+		Stp::r, Stp::rp, Stp::r2, Stp::M, Stp::Mp, Stp::M2,
+		Stp::x, Stp::xp, Stp::x2, Stp::y, Stp::yp, Stp::y2,
+		Stp::NONE // Escape
+	};
 	
 	// Array with metrics string representation
 	const std::string Algorithm::metric_strings[] =
@@ -1447,6 +1500,166 @@ namespace grcube3
 		return changes;
 	}
 
+	// Shrinks the algorithm until no more shrinks can be done - returns true if there were changes. Same result as calling
+	// Shrink while it returns true, but in linear time. The steps are kept in a linked list over the buffer and the rounds
+	// of the Shrink loop (adjacent steps pass, then alternate steps pass) are replayed only where a previous join changed
+	// a step or put two steps together. A plain stack can't be used: the loop result depends on the rounds order, as in
+	// "U D U' D U D'" (the loop gives "D U", a stack gives "U D")
+	bool Algorithm::ShrinkAll()
+	{
+		const uint size = GetSize();
+		uint n = 0u; // Current size
+		for (uint r = 0u; r < size; r++) if (Movs[r] != Stp::NONE) Movs[n++] = Movs[r]; // Remove empty steps
+		Movs.resize(n);
+
+		if (n < 2u) return n != size;
+
+		// A round adds up to two positions to each positions list for each join (less than n joins), the first round adds n
+		const uint End = n, Cap = 2u * n + 1u, BufferSize = 2u * (n + 1u) + 4u * Cap;
+		uint LocalBuffer[10u * 64u + 6u]; // Buffer for the usual algorithms (up to 64 steps)
+		std::vector<uint> HeapBuffer;
+		uint* Buffer = LocalBuffer;
+		if (n > 64u)
+		{
+			HeapBuffer.resize(BufferSize);
+			Buffer = HeapBuffer.data();
+		}
+
+		// Circular linked list, the end position (n) is before the first step and after the last one
+		uint* const Next = Buffer, * const Prev = Buffer + n + 1u;
+		for (uint i = 0u; i <= n; i++)
+		{
+			Next[i] = i == n ? 0u : i + 1u;
+			Prev[i] = i == 0u ? n : i - 1u;
+		}
+		uint Count = n; // Steps in the list
+
+		// Positions with changes (step joined or new next step) to check in the next passes. The first round checks all
+		uint* Adjacent = Prev + n + 1u, * Alternate = Adjacent + Cap, * NextAdjacent = Alternate + Cap, * NextAlternate = NextAdjacent + Cap;
+		uint AdjacentSize = n, AlternateSize = n, NextAdjacentSize = 0u, NextAlternateSize = 0u;
+		for (uint i = 0u; i < n; i++) Adjacent[i] = Alternate[i] = i;
+
+		Stp JoinedStep;
+		bool changes = true;
+
+		while (changes && Count > 1u)
+		{
+			changes = false;
+
+			// Adjacent steps pass, only from the pairs that could have changed (before the limit, the pass is already done)
+			if (!std::is_sorted(Adjacent, Adjacent + AdjacentSize)) std::sort(Adjacent, Adjacent + AdjacentSize);
+			int Limit = -1;
+			for (uint i = 0u; i < AdjacentSize; i++)
+			{
+				const uint Changed = Adjacent[i];
+				if (Movs[Changed] == Stp::NONE) continue; // Step already joined
+
+				const uint Starts[2] = { Prev[Changed], Changed };
+				for (const uint Start : Starts)
+				{
+					if (Start == End || static_cast<int>(Start) <= Limit) continue;
+
+					uint A = Start; // Step to join with the next one
+					for (;;)
+					{
+						const uint B = Next[A];
+						if (B == End || !JoinSteps(Movs[A], Movs[B], JoinedStep)) break;
+
+						changes = true;
+						Count--;
+						Movs[B] = Stp::NONE;
+						Next[A] = Next[B];
+						Prev[Next[B]] = A;
+						if (JoinedStep != Stp::NONE)
+						{ // The joined step is checked against the next step
+							Movs[A] = JoinedStep;
+							Alternate[AlternateSize++] = NextAdjacent[NextAdjacentSize++] = A;
+						}
+						else
+						{ // The previous step is not checked against the next step in this round (as Shrink)
+							const uint P = Prev[A];
+							Count--;
+							Movs[A] = Stp::NONE;
+							Next[P] = Next[A];
+							Prev[Next[A]] = P;
+							if (P != End) Alternate[AlternateSize++] = NextAdjacent[NextAdjacentSize++] = P;
+							if (Next[P] == End) { A = P; break; }
+							A = Next[P];
+						}
+					}
+					if (A != End && static_cast<int>(A) > Limit) Limit = static_cast<int>(A);
+				}
+			}
+
+			if (Count > 2u) // Alternate steps pass (as Shrink)
+			{
+				if (!std::is_sorted(Alternate, Alternate + AlternateSize)) std::sort(Alternate, Alternate + AlternateSize);
+				Limit = -1;
+				for (uint i = 0u; i < AlternateSize; i++)
+				{
+					const uint Changed = Alternate[i];
+					if (Movs[Changed] == Stp::NONE) continue; // Step already joined
+
+					const uint Prev1 = Prev[Changed], Starts[3] = { Prev1 == End ? End : Prev[Prev1], Prev1, Changed };
+					for (const uint Start : Starts)
+					{
+						if (Start == End || static_cast<int>(Start) <= Limit) continue;
+
+						uint A = Start, Joined = End; // A is the first step of the trio, Joined the last joined step
+						for (;;)
+						{
+							const uint B = Next[A];
+							if (B == End) break;
+							const uint C = Next[B];
+							if (C == End) break;
+
+							if (JoinSteps(Movs[A], Movs[B], Movs[C], JoinedStep))
+							{ // [A, B, C] -> [B, joined step]
+								changes = true;
+								const uint P = Prev[A];
+								Count--;
+								Movs[A] = Stp::NONE;
+								Next[P] = B;
+								Prev[B] = P;
+								if (P != End) NextAdjacent[NextAdjacentSize++] = NextAlternate[NextAlternateSize++] = P;
+								if (JoinedStep != Stp::NONE)
+								{
+									Movs[C] = JoinedStep;
+									Joined = C;
+									NextAdjacent[NextAdjacentSize++] = NextAlternate[NextAlternateSize++] = C;
+								}
+								else
+								{
+									Count--;
+									Movs[C] = Stp::NONE;
+									Next[B] = Next[C];
+									Prev[Next[C]] = B;
+									NextAdjacent[NextAdjacentSize++] = NextAlternate[NextAlternateSize++] = B;
+								}
+								A = B;
+							}
+							else if (B == Joined) A = B; // The next trio begins with the joined step
+							else break;
+						}
+						if (static_cast<int>(A) > Limit) Limit = static_cast<int>(A);
+					}
+				}
+			}
+
+			// Next round
+			std::swap(Adjacent, NextAdjacent);
+			std::swap(Alternate, NextAlternate);
+			AdjacentSize = NextAdjacentSize;
+			AlternateSize = NextAlternateSize;
+			NextAdjacentSize = NextAlternateSize = 0u;
+		}
+
+		n = 0u;
+		for (uint r = 0u; r < End; r++) if (Movs[r] != Stp::NONE) Movs[n++] = Movs[r];
+		Movs.resize(n);
+		return n != size;
+	}
+
 	// Shrink last step only - returns true if shrink has been done
 	bool Algorithm::ShrinkLast()
 	{
@@ -1533,21 +1746,133 @@ namespace grcube3
 		return clean_s;
 	}
 	
-	 // Reads steps from plain text and append them to the algorithm
-	bool Algorithm::Append(const std::string& ss)
+	// Reads steps from plain text (chars and length) and append them to the algorithm - single pass over the text, without temporary
+	// strings, with the same rules than CleanString: not allowed chars are ignored, "2'" and "'2" are read as "2" and 'Uw' notation
+	// as 'u'. If the text is not valid nothing is appended and the error is returned with the text position where it has been found
+	Ape Algorithm::Append(const char* Text, const size_t Length, size_t& ErrorPos)
 	{
-		const std::string s = CleanString(ss);
-		if (s.length() == 0 || !CheckParentheses(s)) return false;
-	
-		Stp stp;
-		uint pos = 0u, next_pos;
-		while ((stp = GetStepFromString(s, pos, next_pos)) != Stp::NONE)
+		const size_t StartSize = Movs.size();
+		if (StartSize == 0u) Movs.reserve(Length / 2u + 1u); // Each step needs at least one char and usually a separator
+		size_t pos = 0u, OpenPos = 0u;
+		int nesting = 0;
+		bool Empty = true, Wide;
+		char c, m;
+
+		while (GetTextChar(Text, Length, pos, c))
+		{
+			if (c == 'w') continue; // 'w' not after a step
+			Empty = false;
+
+			Stp S;
+			switch (c)
+			{
+			case 'U': S = Stp::U; break;
+			case 'D': S = Stp::D; break;
+			case 'F': S = Stp::F; break;
+			case 'B': S = Stp::B; break;
+			case 'R': S = Stp::R; break;
+			case 'L': S = Stp::L; break;
+			case 'u': S = Stp::u; break;
+			case 'd': S = Stp::d; break;
+			case 'f': S = Stp::f; break;
+			case 'b': S = Stp::b; break;
+			case 'r': S = Stp::r; break;
+			case 'l': S = Stp::l; break;
+			case 'E': S = Stp::E; break;
+			case 'S': S = Stp::S; break;
+			case 'M': S = Stp::M; break;
+			case 'x': S = Stp::x; break;
+			case 'y': S = Stp::y; break;
+			case 'z': S = Stp::z; break;
+
+			case '(':
+				if (nesting++ == 0) OpenPos = pos - 1u; // Open parenthesis in the outer level
+				Movs.push_back(Stp::PARENTHESIS_OPEN);
+				continue;
+
+			case ')':
+				if (--nesting < 0) // Nesting must be always greater or equal than zero
+				{
+					Movs.resize(StartSize);
+					ErrorPos = pos - 1u;
+					return Ape::CLOSE_WITHOUT_OPEN;
+				}
+				m = GetTextModifier(Text, Length, pos, Wide); // Repetitions
+				Movs.push_back(m >= '2' && m <= '9' ? static_cast<Stp>(static_cast<int>(Stp::PARENTHESIS_OPEN) + m - '0') :
+				                                      Stp::PARENTHESIS_CLOSE_1_REP);
+				continue;
+
+			default: continue; // Modifier not after a step
+			}
+
+			m = GetTextModifier(Text, Length, pos, Wide);
+			if (Wide && S <= Stp::L2) S = static_cast<Stp>(static_cast<int>(S) + static_cast<int>(Stp::u) - static_cast<int>(Stp::U));
+			if (m == '\'') S = static_cast<Stp>(static_cast<int>(S) + 1);
+			else if (m == '2') S = static_cast<Stp>(static_cast<int>(S) + 2);
+			Movs.push_back(S);
+		}
+
+		if (Empty)
 		{
-			Append(stp);
-			pos = next_pos;
+			ErrorPos = 0u;
+			return Ape::EMPTY;
 		}
-	
-		return true;
+		if (nesting > 0)
+		{
+			Movs.resize(StartSize);
+			ErrorPos = OpenPos;
+			return Ape::OPEN_WITHOUT_CLOSE;
+		}
+		return Ape::NONE;
+	}
+
+	// Get the next allowed char in a text from the given position (turns in lower case), the position is updated after the char
+	bool Algorithm::GetTextChar(const char* Text, const size_t Length, size_t& pos, char& c)
+	{
+		while (pos < Length)
+		{
+			c = Text[pos++];
+			switch (c)
+			{
+			case 'U': case 'D': case 'F': case 'B': case 'R': case 'L':
+			case 'u': case 'd': case 'f': case 'b': case 'r': case 'l': case 'w':
+			case 'E': case 'S': case 'M':
+			case 'x': case 'y': case 'z':
+			case '\'': case '(': case ')':
+			case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': return true;
+			case 'X': c = 'x'; return true;
+			case 'Y': c = 'y'; return true;
+			case 'Z': c = 'z'; return true;
+			default: break;
+			}
+		}
+		return false;
+	}
+
+	// Get the modifier after a step in a text ('\'', a number or '\0' if there is no modifier) and if the step is followed by 'w'
+	// (double layer movement), the position is updated after the modifier. Apostrophes just before a '2' are ignored
+	char Algorithm::GetTextModifier(const char* Text, const size_t Length, size_t& pos, bool& Wide)
+	{
+		size_t next_pos = pos;
+		char c;
+
+		Wide = false;
+		while (GetTextChar(Text, Length, next_pos, c))
+		{
+			if (c == 'w') { Wide = true; pos = next_pos; continue; }
+			if (c >= '2' && c <= '9') { pos = next_pos; return c; }
+			if (c == '\'')
+			{
+				size_t run_pos = next_pos;
+				char r = c;
+				while (r == '\'' && GetTextChar(Text, Length, run_pos, r)); // Apostrophes run
+				if (r == '2') { pos = run_pos; return r; } // "'2" is the same than "2"
+				pos = next_pos;
+				return c;
+			}
+			break;
+		}
+		return '\0';
 	}
 	
 	// Append random movements (between initial step and end step) until get the given size (with shrink)
@@ -1596,187 +1921,134 @@ namespace grcube3
 		return false;
 	}
 
-	// Get the step in the 'pos' positions inside the string 's' - static
-	// 'next_pos' is the index of the following char after the current step
-	// String should be a previous cleaned string and with parentheses checked
-	Stp Algorithm::GetStepFromString(const std::string& s, uint pos, uint& next_pos)
+	// Return current algorithm as plain text string
+	std::string Algorithm::ToString(const char sep) const
 	{
-		const uint s_size = static_cast<uint>(s.length());
+		std::string s;
+		AppendToString(s, sep);
+		return s;
+	}
 
-		if (s_size == 0u) { next_pos = 0u; return Stp::NONE; }
-	
-		uint pos_1, pos_2;
-		
-		while(pos < s_size)
+	// Append current algorithm as plain text to the given string (written in place, one step text can have up to two chars)
+	void Algorithm::AppendToString(std::string& s, const char sep) const
+	{
+		const size_t start = s.size();
+		s.resize(start + 3u * Movs.size());
+
+		char* const first = &s[0] + start;
+		char* c = first;
+		for (const auto step : Movs)
 		{
-			pos_1 = pos + 1u; // Position increased in 1
-			pos_2 = pos + 2u; // Position increased in 2
-			
-			switch (s[pos])
+			if (c > first && c[-1] == sep && step > Stp::PARENTHESIS_OPEN) c--; // No separator before a close parenthesis
+			const char* text = m_strings[static_cast<int>(step)];
+			if (text[0] != '\0')
 			{
-				case 'U':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Up; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::U2; }
-					}
-					next_pos = pos_1; return Stp::U;
-				case 'D':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Dp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::D2; }
-					}
-					next_pos = pos_1; return Stp::D;
-				case 'F':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Fp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::F2; }
-					}
-					next_pos = pos_1; return Stp::F;
-				case 'B':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Bp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::B2; }
-					}
-					next_pos = pos_1; return Stp::B;
-				case 'R':
-				if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Rp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::R2; }
-					}
-					next_pos = pos_1; return Stp::R;
-				case 'L':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Lp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::L2; }
-					}
-					next_pos = pos_1; return Stp::L;
-				case 'u':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::up; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::u2; }
-					}
-					next_pos = pos_1; return Stp::u;
-				case 'd':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::dp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::d2; }
-					}
-					next_pos = pos_1; return Stp::d;
-				case 'f':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::fp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::f2; }
-					}
-					next_pos = pos_1; return Stp::f;
-				case 'b':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::bp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::b2; }
-					}
-					next_pos = pos_1; return Stp::b;
-				case 'r':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::rp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::r2; }
-					}
-					next_pos = pos_1; return Stp::r;
-				case 'l':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::lp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::l2; }
-					}
-					next_pos = pos_1; return Stp::l;
-				case 'E':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Ep; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::E2; }
-					}
-					next_pos = pos_1; return Stp::E;
-				case 'S':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Sp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::S2; }
-					}
-					next_pos = pos_1; return Stp::S;
-				case 'M':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::Mp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::M2; }
-					}
-					next_pos = pos_1; return Stp::M;
-				case 'x':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::xp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::x2; }
-					}
-					next_pos = pos_1; return Stp::x;
-				case 'y':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::yp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::y2; }
-					}
-					next_pos = pos_1; return Stp::y;
-				case 'z':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '\'') { next_pos = pos_2; return Stp::zp; }
-						if (s[pos_1] == '2')  { next_pos = pos_2; return Stp::z2; }
-					}
-					next_pos = pos_1; return Stp::z;
-				case '(': next_pos = pos_1; return Stp::PARENTHESIS_OPEN;
-				case ')':
-					if (pos_1 < s_size)
-					{
-						if (s[pos_1] == '2') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_2_REP; }
-						if (s[pos_1] == '3') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_3_REP; }
-						if (s[pos_1] == '4') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_4_REP; }
-						if (s[pos_1] == '5') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_5_REP; }
-						if (s[pos_1] == '6') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_6_REP; }
-						if (s[pos_1] == '7') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_7_REP; }
-						if (s[pos_1] == '8') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_8_REP; }
-						if (s[pos_1] == '9') { next_pos = pos_2; return Stp::PARENTHESIS_CLOSE_9_REP; }
-					}
-					next_pos = pos_1; return Stp::PARENTHESIS_CLOSE_1_REP;
-				default: pos++; break;
+				*c++ = text[0];
+				if (text[1] != '\0') *c++ = text[1];
 			}
+			if (step != Stp::PARENTHESIS_OPEN) *c++ = sep;
 		}
-		next_pos = pos;
-		return Stp::NONE;
+
+		if (c > first && c[-1] == sep) c--;
+		s.resize(static_cast<size_t>(c - &s[0]));
 	}
-	
-	// Return current algorithm as plain text string
-	std::string Algorithm::ToString(const char sep) const
+
+	// Append current algorithm to the given buffer, one byte per step
+	void Algorithm::GetBytes(std::vector<uint8_t>& Buffer) const
 	{
-		std::string s;
+		Buffer.reserve(Buffer.size() + Movs.size());
+		for (const auto step : Movs) Buffer.push_back(static_cast<uint8_t>(step));
+	}
+
+	// Append the steps coded in the given buffer, one byte per step (false if there is a not valid step)
+	bool Algorithm::AppendBytes(const uint8_t* Buffer, const size_t Size)
+	{
+		for (size_t n = 0u; n < Size; n++) if (Buffer[n] > static_cast<uint8_t>(Stp::PARENTHESIS_CLOSE_9_REP)) return false;
+
+		Movs.reserve(Movs.size() + Size);
+		for (size_t n = 0u; n < Size; n++) Movs.push_back(static_cast<Stp>(Buffer[n]));
+		return true;
+	}
 
-        for (const auto step : Movs)
+	// Append current algorithm to the given buffer, five bits per usual step and the escape code followed by seven bits for the
+	// other steps (bits from the less significant in each byte). The steps end with a zero code and the last byte is filled with
+	// zeros, so packed algorithms can be concatenated in the same buffer
+	void Algorithm::GetPacked(std::vector<uint8_t>& Buffer) const
+	{
+		uint Bits = 0u, BitsCount = 0u;
+
+		for (const auto step : Movs)
+		{
+			const uint Code = m_packed_codes[static_cast<int>(step)];
+			Bits |= Code << BitsCount;
+			BitsCount += 5u;
+			if (Code == PACKED_ESCAPE)
+			{
+				Bits |= static_cast<uint>(step) << BitsCount;
+				BitsCount += 7u;
+			}
+			while (BitsCount >= 8u)
+			{
+				Buffer.push_back(static_cast<uint8_t>(Bits));
+				Bits >>= 8u;
+				BitsCount -= 8u;
+			}
+		}
+		BitsCount += 5u; // End code (zero)
+		while (BitsCount > 0u)
 		{
-			if (!s.empty() && s.back() == sep && m_range[static_cast<int>(step)] == Rng::PARENTHESES && step != Stp::PARENTHESIS_OPEN) s.pop_back();
-			s += m_strings[static_cast<int>(step)];
-			if (step != Stp::PARENTHESIS_OPEN) s.push_back(sep);
+			Buffer.push_back(static_cast<uint8_t>(Bits));
+			Bits >>= 8u;
+			BitsCount = BitsCount > 8u ? BitsCount - 8u : 0u;
 		}
+	}
 
-		if (!s.empty() && s.back() == sep) s.pop_back();
-		
-		return s;
+	// Append the steps coded in the given buffer, five bits per usual step, until the end code (false if the buffer is not
+	// valid or has no end code). The used bytes are the bytes until the end code, the next packed algorithm starts there
+	bool Algorithm::AppendPacked(const uint8_t* Buffer, const size_t Size, size_t& Used)
+	{
+		const size_t StartSize = Movs.size();
+		uint Bits = 0u, BitsCount = 0u;
+		size_t n = 0u;
+
+		for (;;)
+		{
+			while (BitsCount < 12u && n < Size) // Enough bits for an escaped step
+			{
+				Bits |= static_cast<uint>(Buffer[n++]) << BitsCount;
+				BitsCount += 8u;
+			}
+			if (BitsCount < 5u) // No end code
+			{
+				Movs.resize(StartSize);
+				return false;
+			}
+
+			const uint Code = Bits & 0x1Fu;
+			if (Code == 0u) // End of the steps
+			{
+				Used = (8u * n - BitsCount + 5u + 7u) / 8u;
+				return true;
+			}
+			Bits >>= 5u;
+			BitsCount -= 5u;
+
+			if (Code != PACKED_ESCAPE) Movs.push_back(m_packed_steps[Code]);
+			else
+			{
+				const uint step = Bits & 0x7Fu;
+				if (BitsCount < 7u || step > static_cast<uint>(Stp::PARENTHESIS_CLOSE_9_REP))
+				{
+					Movs.resize(StartSize);
+					return false;
+				}
+				Movs.push_back(static_cast<Stp>(step));
+				Bits >>= 7u;
+				BitsCount -= 7u;
+			}
+		}
 	}
+
 	
 	// Get the same algorithm with single or without parentheses (default) - steps inside parentheses developed
 	// Should be used before applying the algorithm to a cube
@@ -2201,97 +2473,61 @@ namespace grcube3
 	Algorithm Algorithm::GetCancellations() const 
 	{
 		Algorithm ACanc, ADev = GetDeveloped();
-		while (ADev.Shrink());
+		ADev.ShrinkAll();
 
-		uint i;
-		for (i = 0u; i < ADev.GetSize() - 2u; i++)
+		const uint Size = ADev.GetSize();
+		ACanc.Movs.reserve(Size);
+		uint i, c;
+		for (i = 0u; i + 2u < Size; i++)
 		{
-			bool AllTurns = Algorithm::IsTurn(ADev.At(i)) && Algorithm::IsTurn(ADev.At(i + 1u)) && Algorithm::IsTurn(ADev.At(i + 2u));
-			if (SameAxisSteps(ADev.At(i), ADev.At(i + 1u)) || AllTurns)
+			const Stp S1 = ADev.Movs[i], S2 = ADev.Movs[i + 1u], S3 = ADev.Movs[i + 2u];
+			bool AllTurns = Algorithm::IsTurn(S1) && Algorithm::IsTurn(S2) && Algorithm::IsTurn(S3);
+			if (SameAxisSteps(S1, S2) || AllTurns)
 			{
-				if (SameAxisSteps(ADev.At(i), ADev.At(i + 2u)) || AllTurns) // Test three steps cancellations
+				if (SameAxisSteps(S1, S3) || AllTurns) // Test three steps cancellations
 				{
-					bool found = false;
-					const Algorithm A3 = ADev.GetSubAlgorithm(i, 3u);
-					for (size_t n = 0u; n < Cancellations3.size(); n += 2u)
+					if ((c = CancellationsIndex3[PackCancellationSteps(S1, S2, S3)]) != 0u)
 					{
-						if (A3 == Cancellations3[n])
-						{
-							ACanc += Cancellations3[n + 1u];
-							i += 2u;
-							found = true;
-							break;
-						}
+						ACanc += Cancellations3[c];
+						i += 2u;
 					}
-					if (!found) // Test two steps cancellations
+					else if ((c = CancellationsIndex2[PackCancellationSteps(S1, S2)]) != 0u) // Test two steps cancellations
 					{
-						const Algorithm A2 = ADev.GetSubAlgorithm(i, 2u);
-						for (size_t n = 0u; n < Cancellations2.size(); n += 2u)
-						{
-							if (A2 == Cancellations2[n])
-							{
-								ACanc += Cancellations2[n + 1u];
-								found = true;
-								i++;
-								break;
-							}
-						}
-						if (!found) ACanc.Append(ADev.At(i));
+						ACanc += Cancellations2[c];
+						i++;
 					}
+					else ACanc.Append(S1);
 				}
 				else if (!AllTurns) // Test two steps cancellations
 				{
-					bool found = false;
-					const Algorithm A2 = ADev.GetSubAlgorithm(i, 2u);
-					for (size_t n = 0u; n < Cancellations2.size(); n += 2u)
+					if ((c = CancellationsIndex2[PackCancellationSteps(S1, S2)]) != 0u)
 					{
-						if (A2 == Cancellations2[n])
-						{
-							ACanc += Cancellations2[n + 1u];
-							found = true;
-							i++;
-							break;
-						}
+						ACanc += Cancellations2[c];
+						i++;
 					}
-					if (!found) ACanc.Append(ADev.At(i));
+					else ACanc.Append(S1);
 				}
 			}
-			else ACanc.Append(ADev.At(i));
+			else ACanc.Append(S1);
 		}
 
-		if (i == ADev.GetSize() - 2u) // Two steps left
+		if (i + 2u == Size) // Two steps left
 		{
-			if (SameAxisSteps(ADev.At(ADev.GetSize() - 2u), ADev.At(ADev.GetSize() - 1u))) // Test the last two steps
-			{
-				bool found = false;
-				const Algorithm A2 = ADev.GetSubAlgorithm(ADev.GetSize() - 2u, 2u);
-				for (size_t n = 0u; n < Cancellations2.size(); n += 2u)
-				{
-					if (A2 == Cancellations2[n])
-					{
-						ACanc += Cancellations2[n + 1u];
-						found = true;
-						break;
-					}
-				}
-				if (!found)
-				{
-					ACanc.Append(ADev.At(ADev.GetSize() - 2u));
-					ACanc.Append(ADev.At(ADev.GetSize() - 1u));
-				}
-			}
+			const Stp S1 = ADev.Movs[i], S2 = ADev.Movs[i + 1u];
+			if (SameAxisSteps(S1, S2) && (c = CancellationsIndex2[PackCancellationSteps(S1, S2)]) != 0u) // Test the last two steps
+				ACanc += Cancellations2[c];
 			else
 			{
-				ACanc.Append(ADev.At(ADev.GetSize() - 2u));
-				ACanc.Append(ADev.At(ADev.GetSize() - 1u));
+				ACanc.Append(S1);
+				ACanc.Append(S2);
 			}
 		}
-		else if (i == ADev.GetSize() - 1u) // One step left
+		else if (i + 1u == Size) // One step left
 		{
-			ACanc.Append(ADev.At(ADev.GetSize() - 1u));
+			ACanc.Append(ADev.Movs[i]);
 		}
 
-		while (ACanc.Shrink());
+		ACanc.ShrinkAll();
 
 		return ACanc;
 	}
@@ -2476,138 +2712,314 @@ namespace grcube3
 		return Canc;
 	}
 	
+	// Build the direct index for a collection of cancellation algorithms with the given source size (2 or 3 steps)
+	std::vector<uint16_t> Algorithm::GetCancellationsIndex(const std::vector<Algorithm>& Canc, const uint StepsSize)
+	{
+		const uint PackedSize = static_cast<uint>(Stp::PARENTHESIS_OPEN);
+		std::vector<uint16_t> Index(StepsSize == 3u ? PackedSize * PackedSize * PackedSize : PackedSize * PackedSize, 0u);
+
+		for (size_t n = 0u; n + 1u < Canc.size(); n += 2u)
+		{
+			const Algorithm& Source = Canc[n];
+			if (Source.GetSize() != StepsSize) continue; // Never found in a steps pair / trio
+			bool Movements = true;
+			for (uint i = 0u; i < StepsSize; i++) if (PackCancellationStep(Source.At(i)) == 0u) Movements = false;
+			if (!Movements) continue; // Only movements are checked for cancellations
+
+			const uint Key = StepsSize == 3u ? PackCancellationSteps(Source.At(0u), Source.At(1u), Source.At(2u)) :
+			                                   PackCancellationSteps(Source.At(0u), Source.At(1u));
+
+			if (Index[Key] == 0u) Index[Key] = static_cast<uint16_t>(n + 1u); // The first cancellation for the steps is used
+		}
+		return Index;
+	}
+
 	// Half turn metric (HTM), also known as face turn metric (FTM)
-	uint Algorithm::GetHTM() const
+	uint Algorithm::GetHTM() const { return static_cast<uint>(GetMetric(Metrics::HTM)); }
+
+	// Quarter turn metric (QTM)
+	uint Algorithm::GetQTM() const { return static_cast<uint>(GetMetric(Metrics::QTM)); }
+
+	// Slice turn metric (STM)
+	uint Algorithm::GetSTM() const { return static_cast<uint>(GetMetric(Metrics::STM)); }
+
+	// Quarter slice turn metric (QSTM)
+	uint Algorithm::GetQSTM() const { return static_cast<uint>(GetMetric(Metrics::QSTM)); }
+
+	// Execution turn metric (ETM)
+	uint Algorithm::GetETM() const { return static_cast<uint>(GetMetric(Metrics::ETM)); }
+
+	// Axial turn metric (ATM)
+	uint Algorithm::GetATM() const { return static_cast<uint>(GetMetric(Metrics::ATM)); }
+
+	// Pacelli turn metric (PTM)
+	uint Algorithm::GetPTM() const { return static_cast<uint>(GetMetric(Metrics::PTM)); }
+
+	// 1.5 half turn metric (1.5HTM)
+	float Algorithm::Get15HTM() const { return GetMetric(Metrics::HTM15); }
+
+	// Outer block turn metric (OBTM)
+	uint Algorithm::GetOBTM() const { return static_cast<uint>(GetMetric(Metrics::OBTM)); }
+
+	// Get algorithm metric: only the given metric is computed. The metrics with a value per step are added from the metrics
+	// table without developing the algorithm (the parentheses repetitions multiply the value), only the execution, axial and
+	// Pacelli metrics need the developed steps (steps pairs can be in different parentheses)
+	float Algorithm::GetMetric(const Metrics M) const
 	{
-        const Algorithm A = GetDeveloped();
-        uint HTM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) HTM += m_HTM[static_cast<int>(A.At(n))];
-        return HTM;
-    }
-    
-    // Quarter turn metric (QTM)
-    uint Algorithm::GetQTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint QTM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) QTM += m_QTM[static_cast<int>(A.At(n))];
-        return QTM;
-    }
-    
-    // Slice turn metric (STM)
-    uint Algorithm::GetSTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint STM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) STM += m_STM[static_cast<int>(A.At(n))];
-        return STM;
-    }
-    
-    // Quarter slice turn metric (QSTM)
-    uint Algorithm::GetQSTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint QSTM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) QSTM += m_QSTM[static_cast<int>(A.At(n))];
-        return QSTM;
-    }
-    
-    // Execution turn metric (ETM)
-    uint Algorithm::GetETM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint ETM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++)
-        {
-            if (IsTurn(A.At(n)) && IsTurn(A.At(n + 1u)))
-            {
-                ETM++;
-                n++;
-                continue;
-            }
-            if (IsSingleMov(A.At(n)) && (OppositeSteps(A.At(n), A.At(n + 1u)) ||
-                                         OppositeSteps(A.At(n), InvertedStep(A.At(n + 1u)))))
-            {
-                ETM++;
-                n++;
-                continue;
-            }
-            ETM += m_ETM[static_cast<int>(A.At(n))];
-        }
-        return ETM;
-    }
-    
-    // Axial turn metric (ATM)
-    uint Algorithm::GetATM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint ATM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++)
-        {
-            if (IsSingleMov(A.At(n)) && (OppositeSteps(A.At(n), A.At(n + 1u)) ||
-                                         OppositeSteps(A.At(n), InvertedStep(A.At(n + 1u)))))
-            {
-                ATM++;
-                n++;
-                continue;
-            }
-            ATM += m_ATM[static_cast<int>(A.At(n))];
-        }
-        return ATM;
-    }
-    
-    // Pacelli turn metric (PTM)
-    uint Algorithm::GetPTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint PTM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++)
-        {
-            if (IsSingleMov(A.At(n)) && (OppositeSteps(A.At(n), A.At(n + 1u)) ||
-                                         OppositeSteps(A.At(n), InvertedStep(A.At(n + 1u)))))
-            {
-                PTM++;
-                n++;
-                continue;
-            }
-            PTM += m_PTM[static_cast<int>(A.At(n))];
-        }
-        return PTM;
-    }
-    
-    // 1.5 half turn metric (1.5HTM)	
-    float Algorithm::Get15HTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        float HTM15 = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) HTM15 += m_15HTM[static_cast<int>(A.At(n))];
-        return HTM15;
-    }
-    
-    // Outer block turn metric (OBTM)
-    uint Algorithm::GetOBTM() const
-    {
-        const Algorithm A = GetDeveloped();
-        uint OBTM = 0u;
-        for (uint n = 0u; n < A.GetSize(); n++) OBTM += m_OBTM[static_cast<int>(A.At(n))];
-        return OBTM;
-    }
+		const bool OnlyMovements = HasOnlyMovements();
+		if (!OnlyMovements && !CheckParentheses()) // Not valid parentheses
+			return M == Metrics::Movements ? static_cast<float>(GetNumSteps()) : 0.0f;
 
-    // Get algorithm metric
-    float Algorithm::GetMetric(const Metrics M) const
-    {
-        switch (M)
-        {
-        case Metrics::HTM: return static_cast<float>(GetHTM());
-        case Metrics::QTM: return static_cast<float>(GetQTM());
-        case Metrics::STM: return static_cast<float>(GetSTM());
-        case Metrics::QSTM: return static_cast<float>(GetQSTM());
-        case Metrics::ATM: return static_cast<float>(GetATM());
-        case Metrics::ETM: return static_cast<float>(GetETM());
-        case Metrics::PTM: return static_cast<float>(GetPTM());
-        case Metrics::HTM15: return Get15HTM();
-        case Metrics::OBTM: return static_cast<float>(GetOBTM());
-        default: return static_cast<float>(GetNumSteps());
-        }
-    }
+		if (M == Metrics::ETM || M == Metrics::ATM || M == Metrics::PTM)
+		{
+			uint ETM, ATM, PTM;
+			if (OnlyMovements) GetPairsMetrics(Movs, ETM, ATM, PTM);
+			else
+			{
+				std::vector<Stp> Developed;
+				Developed.reserve(2u * Movs.size());
+				uint pos = 0u;
+				AppendDevelopedSteps(Developed, pos);
+				GetPairsMetrics(Developed, ETM, ATM, PTM);
+			}
+			return static_cast<float>(M == Metrics::ETM ? ETM : (M == Metrics::ATM ? ATM : PTM));
+		}
+
+		uint pos = 0u;
+		return GetStepsMetric(M, pos);
+	}
+
+	// Get all algorithm metrics and the subjective score in a single pass over the steps (the algorithm is developed only
+	// if there are parentheses or empty steps)
+	AlgorithmMetrics Algorithm::GetMetrics() const
+	{
+		AlgorithmMetrics AM;
+		AM.Values.fill(0.0f);
+		AM.Score = GetSubjectiveScore();
+
+		if (HasOnlyMovements()) AddMetrics(AM, Movs);
+		else if (CheckParentheses())
+		{
+			std::vector<Stp> Developed;
+			Developed.reserve(2u * Movs.size());
+			uint pos = 0u;
+			AppendDevelopedSteps(Developed, pos);
+			AddMetrics(AM, Developed);
+		}
+		else AM.Values[static_cast<int>(Metrics::Movements)] = static_cast<float>(GetNumSteps()); // Not valid parentheses
+
+		return AM;
+	}
+
+	// Check if the algorithm has only movements (no parentheses and no empty steps)
+	bool Algorithm::HasOnlyMovements() const
+	{
+		for (const auto step : Movs)
+		{
+			const Rng R = m_range[static_cast<int>(step)];
+			if (R == Rng::NONE || R == Rng::PARENTHESES) return false;
+		}
+		return true;
+	}
+
+	// Add the values in the metrics table for the given metric from the given position until the end of the algorithm or the
+	// close parenthesis for the current level (as AppendDevelopedSteps), only for algorithms with valid parentheses
+	float Algorithm::GetStepsMetric(const Metrics M, uint& pos) const
+	{
+		const MetricsTable& StepsMetrics = GetMetricsTable();
+		const int iM = static_cast<int>(M);
+		float Value = 0.0f;
+
+		for (; pos < GetSize(); pos++)
+		{
+			const Stp S = Movs[pos];
+
+			if (S == Stp::PARENTHESIS_OPEN)
+			{
+				const float Group = GetStepsMetric(M, ++pos);
+				Value += Group * static_cast<float>(GetCloseParenthesisRepetitions(Movs[pos]));
+			}
+			else if (m_range[static_cast<int>(S)] == Rng::PARENTHESES) return Value; // Close parenthesis
+			else Value += StepsMetrics[static_cast<int>(S)][iM]; // Empty steps have zero values
+		}
+		return Value;
+	}
+
+	// Add the metrics for the given steps (only movements): the metric values for each step are added in a fixed size loop
+	void Algorithm::AddMetrics(AlgorithmMetrics& AM, const std::vector<Stp>& Steps)
+	{
+		const MetricsTable& StepsMetrics = GetMetricsTable();
+
+		std::array<float, METRICS_NUMBER> Values = AM.Values;
+		for (const auto S : Steps)
+			for (uint m = 0u; m < METRICS_NUMBER; m++) Values[m] += StepsMetrics[static_cast<int>(S)][m];
+
+		uint ETM, ATM, PTM;
+		GetPairsMetrics(Steps, ETM, ATM, PTM);
+
+		AM.Values = Values;
+		AM.Values[static_cast<int>(Metrics::ETM)] = static_cast<float>(ETM);
+		AM.Values[static_cast<int>(Metrics::ATM)] = static_cast<float>(ATM);
+		AM.Values[static_cast<int>(Metrics::PTM)] = static_cast<float>(PTM);
+	}
+
+	// Get the execution, axial and Pacelli metrics for the given steps (only movements), checking the steps pairs done as a
+	// single movement
+	void Algorithm::GetPairsMetrics(const std::vector<Stp>& Steps, uint& ETM, uint& ATM, uint& PTM)
+	{
+		const size_t Size = Steps.size();
+		ETM = ATM = PTM = 0u; // Pacelli metric has the same steps pairs than axial metric
+		bool ETMPair = false, ATMPair = false; // Current step is the second step in a pair
+
+		for (size_t n = 0u; n < Size; n++)
+		{
+			const Stp S = Steps[n], Next = n + 1u < Size ? Steps[n + 1u] : Stp::NONE;
+			const int iS = static_cast<int>(S);
+
+			const bool OppositePair = IsSingleMov(S) && (OppositeSteps(S, Next) || OppositeSteps(S, InvertedStep(Next)));
+
+			if (ETMPair) ETMPair = false;
+			else if ((IsTurn(S) && IsTurn(Next)) || OppositePair) { ETM++; ETMPair = true; }
+			else ETM += m_ETM[iS];
+
+			if (ATMPair) ATMPair = false;
+			else if (OppositePair) { ATM++; PTM++; ATMPair = true; }
+			else { ATM += m_ATM[iS]; PTM += m_PTM[iS]; }
+		}
+	}
+
+	// Append the developed steps from the given position until the end of the algorithm or the close parenthesis for the current
+	// level (the position is updated to the close parenthesis), only for algorithms with valid parentheses
+	void Algorithm::AppendDevelopedSteps(std::vector<Stp>& Developed, uint& pos) const
+	{
+		for (; pos < GetSize(); pos++)
+		{
+			const Stp S = Movs[pos];
+			const Rng R = m_range[static_cast<int>(S)];
+
+			if (S == Stp::PARENTHESIS_OPEN)
+			{
+				const size_t Start = Developed.size();
+				AppendDevelopedSteps(Developed, ++pos);
+				const size_t End = Developed.size();
+				for (uint rep = 1u; rep < GetCloseParenthesisRepetitions(Movs[pos]); rep++)
+					for (size_t n = Start; n < End; n++) Developed.push_back(Developed[n]);
+			}
+			else if (R == Rng::PARENTHESES) return; // Close parenthesis
+			else if (R != Rng::NONE) Developed.push_back(S);
+		}
+	}
+
+	// Get the metric values for each step (a movement counts as one step for the movements metric), built once
+	const Algorithm::MetricsTable& Algorithm::GetMetricsTable()
+	{
+		static const MetricsTable Table = BuildMetricsTable();
+		return Table;
+	}
+
+	// Build the metric values for each step
+	Algorithm::MetricsTable Algorithm::BuildMetricsTable()
+	{
+		MetricsTable Table;
+
+		for (uint s = 0u; s < Table.size(); s++)
+		{
+			Table[s].fill(0.0f);
+			if (m_range[s] == Rng::NONE || m_range[s] == Rng::PARENTHESES) continue;
+
+			Table[s][static_cast<int>(Metrics::Movements)] = 1.0f;
+			Table[s][static_cast<int>(Metrics::HTM)] = static_cast<float>(m_HTM[s]);
+			Table[s][static_cast<int>(Metrics::QTM)] = static_cast<float>(m_QTM[s]);
+			Table[s][static_cast<int>(Metrics::STM)] = static_cast<float>(m_STM[s]);
+			Table[s][static_cast<int>(Metrics::QSTM)] = static_cast<float>(m_QSTM[s]);
+			Table[s][static_cast<int>(Metrics::HTM15)] = m_15HTM[s];
+			Table[s][static_cast<int>(Metrics::OBTM)] = static_cast<float>(m_OBTM[s]);
+		}
+		return Table;
+	}
+
+	// Steps groups data for the canonical sequences (U, D, F, B, R, L, u, d, f, b, r, l, E, S, M, x, y, z)
+	const uint CanonicalSequences::StepAxis[18] = { 0u, 0u, 1u, 1u, 2u, 2u, 0u, 0u, 1u, 1u, 2u, 2u, 0u, 1u, 2u, 2u, 0u, 1u };
+	const uint CanonicalSequences::StepFamily[18] = { 0u, 1u, 0u, 1u, 0u, 1u, 2u, 3u, 2u, 3u, 2u, 3u, 4u, 4u, 4u, 5u, 5u, 5u };
+	const uint CanonicalSequences::StepTurns[3] = { 1u, 3u, 2u }; // Clockwise quarter turns for S, S' and S2
+
+	// Get the canonical runs for the given allowed steps (computed once for each steps list and shared)
+	const CanonicalSequences& CanonicalSequences::Get(const std::vector<Stp>& Steps)
+	{
+		static std::mutex TablesMutex;
+		static std::map<uint64_t, std::unique_ptr<CanonicalSequences>> Tables; // Canonical runs for each allowed steps
+
+		uint64_t AllowedSteps = 0u;
+		for (const auto S : Steps) if (S != Stp::NONE && S < Stp::PARENTHESIS_OPEN) AllowedSteps |= 1ull << static_cast<uint>(S);
+
+		std::lock_guard<std::mutex> guard(TablesMutex);
+		std::unique_ptr<CanonicalSequences>& Table = Tables[AllowedSteps];
+		if (Table == nullptr) Table.reset(new CanonicalSequences(AllowedSteps));
+		return *Table;
+	}
+
+	// Compute the canonical runs: a run is canonical if the run without his last step is canonical and there is no
+	// shorter run (or a run with the same length and lower steps) with the same effect made with allowed steps
+	CanonicalSequences::CanonicalSequences(const uint64_t Allowed)
+	{
+		CanonicalRuns.assign(3u * RunCodes, false);
+
+		Complete = true;
+		for (uint g = 0u; g < 18u; g++)
+		{
+			const uint64_t GroupMask = 7ull << (1u + 3u * g); // Bits for the three turns of the steps group
+			if ((Allowed & GroupMask) != 0u && (Allowed & GroupMask) != GroupMask) Complete = false;
+		}
+
+		for (uint Axis = 0u; Axis < 3u; Axis++)
+		{
+			// Clockwise quarter turns (from the first face view) for the three layers in the axis for each steps family: face, opposite
+			// face, wide face, wide opposite face, middle layer (E follows D, S follows F, M follows L) and rotation
+			const int Middle = Axis == 1u ? 1 : -1;
+			const int Layers[6][3] = { { 1, 0, 0 }, { 0, 0, -1 }, { 1, 1, 0 }, { 0, -1, -1 }, { 0, Middle, 0 }, { 1, 1, 1 } };
+
+			uint Groups[6]; // Steps group for each family in this axis
+			for (uint g = 0u; g < 18u; g++) if (StepAxis[g] == Axis) Groups[StepFamily[g]] = g;
+
+			// Runs sorted by length and steps
+			std::vector<std::pair<std::vector<uint>, uint>> SortedRuns;
+			for (uint Code = 0u; Code < RunCodes; Code++)
+			{
+				std::vector<uint> Key(1u, 0u); // Run length and steps
+				for (uint f = 0u; f < 6u; f++)
+				{
+					const uint Turns = (Code >> (2u * f)) & 3u;
+					if (Turns == 0u) continue;
+					Key[0]++;
+					Key.push_back(1u + 3u * Groups[f] + (Turns == 1u ? 0u : Turns == 3u ? 1u : 2u)); // Step index
+				}
+				SortedRuns.push_back(std::make_pair(Key, Code));
+			}
+			std::sort(SortedRuns.begin(), SortedRuns.end());
+
+			std::vector<bool> UsedEffects(64u, false); // Four possible turns for each layer
+			for (const auto& R : SortedRuns)
+			{
+				const uint Code = R.second;
+				uint Effect = 0u, Prefix = 0u;
+				for (uint l = 0u; l < 3u; l++)
+				{
+					int Turns = 0;
+					for (uint f = 0u; f < 6u; f++) Turns += Layers[f][l] * static_cast<int>((Code >> (2u * f)) & 3u);
+					Effect = Effect * 4u + static_cast<uint>(((Turns % 4) + 4) % 4);
+				}
+				for (uint f = 6u; f-- > 0u;) if ((Code >> (2u * f)) & 3u) { Prefix = Code & ~(3u << (2u * f)); break; }
+
+				if ((Code == 0u || CanonicalRuns[Axis * RunCodes + Prefix]) && !UsedEffects[Effect])
+				{
+					CanonicalRuns[Axis * RunCodes + Code] = true;
+
+					// Only a run with allowed steps prevents other runs with the same effect
+					bool AllowedRun = true;
+					for (uint n = 1u; n < R.first.size(); n++) if (((Allowed >> R.first[n]) & 1u) == 0u) AllowedRun = false;
+					if (AllowedRun) UsedEffects[Effect] = true;
+				}
+			}
+		}
+	}
 }
@@ -25,17 +25,36 @@
 #include <string>
 #include <array>
 #include <vector>
+#include <cstdint>
+#include <cstring>
 
 #include "cube_definitions.h"
 
 namespace grcube3
 {
+	enum class Ape // Algorithm text parse errors
+	{
+		NONE, // No error
+		EMPTY, // No movements in the text
+		CLOSE_WITHOUT_OPEN, // Close parenthesis without a previous open parenthesis
+		OPEN_WITHOUT_CLOSE // Open parenthesis without a later close parenthesis
+	};
+
+	// All the metrics for an algorithm and his subjective score
+	struct AlgorithmMetrics
+	{
+		std::array<float, METRICS_NUMBER> Values; // Metric values (index is the metric)
+		uint Score; // Subjective score
+
+		float Get(const Metrics M) const { return Values[static_cast<int>(M)]; }
+	};
+
 	class Algorithm
 	{
 	public:
 		Algorithm() { }; // Empty algorithm constructor
 		Algorithm(const uint n) { Append(n); } // Random algorithm constructor
-		Algorithm(const char* s) { const std::string ss(s); Append(ss); } // Algorithm from chars array
+		Algorithm(const char* s) { size_t ErrorPos; Append(s, std::strlen(s), ErrorPos); } // Algorithm from chars array
 		Algorithm(const std::string& s) { Append(s); } // Algorithm from string constructor
 		~Algorithm() { } // Destructor
 		
@@ -71,7 +90,8 @@ namespace grcube3
         uint GetPTM() const; // Pacelli turn metric (PTM)
         float Get15HTM() const; // 1.5 half turn metric (1.5HTM)	
         uint GetOBTM() const; // Outer block turn metric (OBTM)
-        float GetMetric(const Metrics = Metrics::Movements) const; // Get algorithm metric
+        float GetMetric(const Metrics = Metrics::Movements) const; // Get algorithm metric (only the given metric is computed)
+		AlgorithmMetrics GetMetrics() const; // Get all algorithm metrics and the subjective score in a single pass
 		
 		int GetParenthesesNesting() const; // Gets parentheses nesting - 0 for parentheses OK
 		
@@ -98,7 +118,11 @@ namespace grcube3
 		bool AppendShrink(const Stp stp) { Movs.push_back(stp);  return ShrinkLast(); } // Append given step at the end of the algorithm and shrink it
 		// Append given algorithm at the end of the algorithm (no shrinking)
 		void Append(const Algorithm& A) { for (uint n = 0u; n < A.GetSize(); n++) Append(A.At(n)); }
-		bool Append(const std::string&); // Append given text algorithm at the end of the algorithm (no shrink)
+		// Append given text algorithm at the end of the algorithm (no shrink)
+		bool Append(const std::string& s) { size_t ErrorPos; return Append(s.data(), s.length(), ErrorPos) == Ape::NONE; }
+		// Append given text algorithm (chars and length) at the end of the algorithm (no shrink), if the text is not valid nothing
+		// is appended and the error is returned with the text position where it has been found
+		Ape Append(const char*, const size_t, size_t&);
         void Append(const uint, const Stp = Stp::U, const Stp = Stp::L2); // Append random movements (by default U, D, F, B, R ,L) until get the given size (with shrink)
 
 		bool Insert(const uint, const Stp); // Insert given step in given position
@@ -106,6 +130,14 @@ namespace grcube3
 		bool InsertParentheses(const uint, const uint, const uint = 1u); // Surround the given range in parentheses with the given repetitions
 		
 		std::string ToString(const char = ' ') const; // Return current algorithm as plain text string
+		void AppendToString(std::string&, const char = ' ') const; // Append current algorithm as plain text to the given string
+
+		// Compact binary encodings, the steps are appended to the given buffer or to the algorithm (nothing is appended if the
+		// buffer is not valid)
+		void GetBytes(std::vector<uint8_t>&) const; // One byte per step
+		bool AppendBytes(const uint8_t*, const size_t);
+		void GetPacked(std::vector<uint8_t>&) const; // Five bits per usual step (twelve bits for other steps), with end code
+		bool AppendPacked(const uint8_t*, const size_t, size_t&); // Also gives the used bytes (the next packed algorithm position)
 		
 		Algorithm GetDeveloped(const bool = false) const; // Gets the same algorithm with single or without parentheses -default- (steps inside parentheses developed)
 		Algorithm GetSimplified() const; // Gets the same algorithm with single layer movements and turns and no parentheses (should be used before applying the algorithm to a cube)
@@ -115,6 +147,7 @@ namespace grcube3
 		Algorithm GetRegrip() const; // Returns the same algorithm with turns for getting most comfortable (subjective) movements
 		
 		bool Shrink(); // Returns false if the algorithm is shrinked; if returns true apply shrink again
+		bool ShrinkAll(); // Shrinks the algorithm until no more shrinks can be done (same result as the Shrink loop, in linear time), returns true if there were changes
 		bool ShrinkLast(); // Shrinks last step only
 
 		void Transform_x() { for (auto& S : Movs) S = m_x[static_cast<int>(S)];	} // Transform the algorithm applying an x turn
@@ -170,7 +203,7 @@ namespace grcube3
 		// Returns true if given steps are in opposite layers (and steps are single layer ones <- Commented for speed) 
 		static bool OppositeSteps(const Stp S1, const Stp S2) {	return (m_layer[static_cast<int>(S1)] == m_layer_opposite[static_cast<int>(S2)]) /* &&
 			                                                               (m_range[static_cast<int>(S1)] == Ranges::SINGLE)*/; }
-		static std::string GetTextStep(const Stp s) { return m_strings[static_cast<uint>(s)]; }
+		static std::string GetTextStep(const Stp s) { return std::string(m_strings[static_cast<uint>(s)]); }
         static Stp InvertedStep(const Stp s) { return m_inverted[static_cast<uint>(s)]; }
 
 		static bool SameAxisSteps(const Stp, const Stp); // Returns true if the given steps turns around the same axis
@@ -238,20 +271,170 @@ namespace grcube3
         const static uint m_PTM[]; // Pacelli turn metric (PTM)
         const static float m_15HTM[]; // 1.5 half turn metric (1.5HTM)	
         const static uint m_OBTM[]; // Outer block turn metric (OBTM)
+
+		// Metric values for each step, for the metrics with a value per step (execution, axial and Pacelli metrics are zero)
+		using MetricsTable = std::array<std::array<float, METRICS_NUMBER>, static_cast<std::size_t>(Stp::PARENTHESIS_CLOSE_9_REP) + 1u>;
+		static const MetricsTable& GetMetricsTable(); // Get the metric values for each step
+		static MetricsTable BuildMetricsTable(); // Build the metric values for each step
+		static void AddMetrics(AlgorithmMetrics&, const std::vector<Stp>&); // Add the metrics for the steps (only movements)
+		static void GetPairsMetrics(const std::vector<Stp>&, uint&, uint&, uint&); // Execution, axial and Pacelli metrics for the steps (only movements)
+		float GetStepsMetric(const Metrics, uint&) const; // Add the metric values for the steps from the given position (without developing)
+		bool HasOnlyMovements() const; // Check if there are only movements (no parentheses and no empty steps)
+		void AppendDevelopedSteps(std::vector<Stp>&, uint&) const; // Append the developed steps from the given position
 	
 		const static std::array<char, 33u> m_chars; // Array with allowed chars in an algorithm
 	
-		const static std::string m_strings[]; // Array with steps string representation
+		const static char m_strings[][3]; // Array with steps string representation
+
+		const static uint8_t m_packed_codes[]; // Array with the five bits code for each step (PACKED_ESCAPE for other steps)
+		const static Stp m_packed_steps[]; // Array with the step for each five bits code
+		static constexpr uint PACKED_ESCAPE = 31u; // Five bits code followed by the seven bits step
 		
 		const static std::string metric_strings[]; // Array with metrics string representation
 		
 		const static uint m_scores[]; // Array with subjective score for each movement
 
 		const static std::vector<Algorithm> Cancellations2, Cancellations3; // Cancellations
+
+		// Direct indexed cancellations, for each packed steps pair / trio the position of the target algorithm in the
+		// cancellations vector (0 if there is no cancellation for these steps)
+		const static std::vector<uint16_t> CancellationsIndex2, CancellationsIndex3;
+
+		// Packed steps for the direct indexed cancellations (parentheses are packed as no movement, without cancellations)
+		static uint PackCancellationStep(const Stp S) { return S < Stp::PARENTHESIS_OPEN ? static_cast<uint>(S) : 0u; }
+		static uint PackCancellationSteps(const Stp S1, const Stp S2)
+		{
+			return PackCancellationStep(S1) * static_cast<uint>(Stp::PARENTHESIS_OPEN) + PackCancellationStep(S2);
+		}
+		static uint PackCancellationSteps(const Stp S1, const Stp S2, const Stp S3)
+		{
+			return PackCancellationSteps(S1, S2) * static_cast<uint>(Stp::PARENTHESIS_OPEN) + PackCancellationStep(S3);
+		}
 		
-		static Stp GetStepFromString(const std::string&, uint, uint&); // Get a step inside the string
+		static bool GetTextChar(const char*, const size_t, size_t&, char&); // Get the next allowed char in a text
+		static char GetTextModifier(const char*, const size_t, size_t&, bool&); // Get the modifier after a step in a text
 
 		// Load a collection of cancelllation algorithms from an XML file
 		static std::vector<Algorithm> LoadXMLCancellationsFile(const std::string&);
+
+		// Build the direct index for a collection of cancellation algorithms with the given source size (2 or 3 steps)
+		static std::vector<uint16_t> GetCancellationsIndex(const std::vector<Algorithm>&, const uint);
+	};
+
+	// Canonical sequences automaton for the search trees
+	// Consecutive steps around the same axis commute, so different sequences of them have the same effect ("U D" and "D U",
+	// "U E'" and "u", "R r'" and "M'"...). Only a sequence for each effect is canonical: the shortest one with the steps sorted,
+	// and the lowest steps if there are more than one. The automaton state is the current run of steps around the same axis
+	// (last steps), and a step is allowed only if the run with the new step is still canonical.
+	// The canonical runs depend on the allowed steps ("R r'" is canonical if M steps are not allowed), so each steps list has
+	// his own table (see Get). If some step is allowed without his inverted or double step (as F' without F2), the equivalent
+	// sorted run could need not allowed steps, so those lists only use the search branches filter (see IsComplete)
+	class CanonicalSequences
+	{
+	public:
+		typedef uint16_t State; // 0 for no run, else 1 + axis * RunCodes + run code (two bits with the turns for each steps family)
+		static constexpr State Start = 0u; // Initial state (no steps)
+		static constexpr uint RunCodes = 4096u; // Run codes for each axis (six steps families)
+
+		// Get the canonical runs for the given allowed steps (computed once for each steps list and shared)
+		static const CanonicalSequences& Get(const std::vector<Stp>&);
+
+		// Get the next state after the given step (steps out of the axes, as parentheses, reset the automaton)
+		static State Next(const State s, const Stp S)
+		{
+			if (S == Stp::NONE || S >= Stp::PARENTHESIS_OPEN) return Start;
+			const uint i = static_cast<uint>(S) - 1u, Axis = StepAxis[i / 3u], Shift = 2u * StepFamily[i / 3u];
+			const uint Code = (s != Start && (s - 1u) / RunCodes == Axis) ? (s - 1u) % RunCodes : 0u;
+			const uint Turns = (((Code >> Shift) & 3u) + StepTurns[i % 3u]) & 3u;
+			return static_cast<State>(1u + Axis * RunCodes + ((Code & ~(3u << Shift)) | (Turns << Shift)));
+		}
+
+		// Returns true if the given step after the given state keeps the sequence canonical (only for complete steps lists)
+		bool IsAllowed(const State s, const Stp S) const
+		{
+			if (S == Stp::NONE || S >= Stp::PARENTHESIS_OPEN) return true;
+			const uint i = static_cast<uint>(S) - 1u, Axis = StepAxis[i / 3u], Shift = 2u * StepFamily[i / 3u];
+			uint Code = 0u;
+			if (s != Start && (s - 1u) / RunCodes == Axis)
+			{
+				Code = (s - 1u) % RunCodes;
+				if ((Code >> Shift) != 0u) return false; // Steps in a run must be sorted (no steps of the same or upper families)
+			}
+			return CanonicalRuns[Axis * RunCodes + (Code | (StepTurns[i % 3u] << Shift))];
+		}
+
+		// Returns true if the allowed steps include the three turns for each allowed layer (the canonical runs can be used)
+		bool IsComplete() const { return Complete; }
+
+		// Returns true if both steps turn around the same axis (they commute)
+		static bool SameAxis(const Stp S1, const Stp S2)
+		{
+			if (S1 == Stp::NONE || S1 >= Stp::PARENTHESIS_OPEN || S2 == Stp::NONE || S2 >= Stp::PARENTHESIS_OPEN) return false;
+			return StepAxis[(static_cast<uint>(S1) - 1u) / 3u] == StepAxis[(static_cast<uint>(S2) - 1u) / 3u];
+		}
+
+	private:
+		static const uint StepAxis[18], StepFamily[18]; // Axis (UD, FB, RL) and family in the axis for each steps group (U, D, F... z)
+		static const uint StepTurns[3]; // Quarter turns for the step, the inverted step and the double step
+
+		std::vector<bool> CanonicalRuns; // Canonical runs for each axis
+		bool Complete; // All the turns for each allowed steps group are allowed
+
+		CanonicalSequences(const uint64_t); // Compute the canonical runs for the allowed steps (a bit for each step)
+	};
+
+	// Fixed capacity steps stack for the search trees (the current branch algorithm without heap allocations)
+	class SearchPath
+	{
+	public:
+		static constexpr uint MaxSize = 128u; // Maximum number of steps in a search branch
+
+		SearchPath() { Size = 0u; } // Empty path constructor
+		SearchPath(const Algorithm& A) { Size = 0u; Push(A); } // Path from algorithm constructor
+
+		Stp operator[](const uint pos) const { return Steps[pos]; } // Return step at position (no range check)
+
+		// Add a step at the end of the path (no shrink)
+		void Push(const Stp S)
+		{
+			States[Size] = CanonicalSequences::Next(Size == 0u ? CanonicalSequences::Start : States[Size - 1u], S);
+			Steps[Size++] = S;
+		}
+		void Push(const Algorithm& A) { for (uint n = 0u; n < A.GetSize(); n++) Push(A.At(n)); } // Add an algorithm at the end of the path
+		void Pop() { Size--; } // Remove the last step
+		void Pop(const uint n) { Size -= n; } // Remove the last n steps
+		void Clear() { Size = 0u; } // Clear the path
+
+		uint GetSize() const { return Size; } // Get the path length
+		bool Empty() const { return Size == 0u; } // Path is empty
+		Stp Last() const { return Size == 0u ? Stp::NONE : Steps[Size - 1u]; } // Get the path last step
+		Stp PenultimateInverted() const { return Size < 2u ? Stp::NONE : Algorithm::InvertedStep(Steps[Size - 2u]); } // Gets the inverted penultimate step
+
+		// Returns true if the given step after the path is a canonical sequence (no other branch with the same effect with the
+		// allowed steps for the canonical runs)
+		bool IsCanonical(const Stp S, const CanonicalSequences& CS) const
+		{
+			if (CS.IsComplete()) return CS.IsAllowed(Size == 0u ? CanonicalSequences::Start : States[Size - 1u], S);
+
+			// Search branches filter: opposite steps sorted and no steps that shrink with the previous ones
+			if (Size == 0u) return true;
+			Stp Joined;
+			if (Algorithm::OppositeSteps(Steps[Size - 1u], S) && Steps[Size - 1u] > S) return false;
+			if (Algorithm::JoinSteps(Steps[Size - 1u], S, Joined)) return false;
+			return Size < 2u || !Algorithm::JoinSteps(Steps[Size - 2u], Steps[Size - 1u], S, Joined);
+		}
+
+		// Get the path as a regular algorithm
+		Algorithm GetAlgorithm() const
+		{
+			Algorithm A;
+			for (uint n = 0u; n < Size; n++) A.Append(Steps[n]);
+			return A;
+		}
+
+	private:
+		std::array<Stp, MaxSize> Steps; // Path steps
+		std::array<CanonicalSequences::State, MaxSize> States; // Canonical sequences automaton state after each step
+		uint Size; // Current number of steps
 	};
 }
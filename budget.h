@@ -0,0 +1,114 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "cube_definitions.h"
+
+namespace grcube3
+{
+	// Token to cancel the searches from any thread (the same token can be shared by several searches)
+	class CancellationToken
+	{
+	public:
+		CancellationToken() { Cancelled = false; }
+
+		void Cancel() { Cancelled.store(true, std::memory_order_relaxed); } // Request the cancellation (thread safe)
+		void Reset() { Cancelled.store(false, std::memory_order_relaxed); } // Allow new searches with this token
+		bool IsCancelled() const { return Cancelled.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<bool> Cancelled;
+	};
+
+	// Nodes searched by a thread since his last budget check (padded to avoid sharing cache lines between threads)
+	struct NodesCounter
+	{
+		uint Nodes;
+		uint8_t Padding[60];
+
+		NodesCounter() { Nodes = 0u; }
+	};
+
+	// Limits for the searches: maximum number of nodes, wall-clock deadline and cancellation token
+	// A budget can be shared by all the searches for a scramble (nodes are accumulated). The search threads check the
+	// limits every ChunkNodes nodes, so a search can exceed the nodes limit in a few chunks per thread
+	class SearchBudget
+	{
+	public:
+		static const uint ChunkNodes = 4096u; // Nodes searched by a thread between limits checks
+
+		SearchBudget() { Clear(); }
+
+		void SetMaxNodes(const uint64_t n) { MaxNodes = n; } // Maximum number of nodes (0 means no limit)
+		void SetDeadline(const std::chrono::steady_clock::time_point& t) { Deadline = t; HasDeadline = true; } // Wall-clock limit
+		void SetTimeLimit(const double Seconds) // Wall-clock limit from now
+		{
+			SetDeadline(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(Seconds)));
+		}
+		void SetToken(const CancellationToken* t) { Token = t; } // Cancellation token (nullptr for no token)
+
+		// Remove all limits and reset the counters
+		void Clear() { MaxNodes = 0u; HasDeadline = false; Token = nullptr; Reset(); }
+
+		// Reset the nodes counter and the exhausted state (limits are kept)
+		void Reset() { Nodes = 0u; Exhausted = false; }
+
+		// Add searched nodes and check the limits, returns false if the budget is exhausted (thread safe)
+		bool Spend(const uint64_t n)
+		{
+			const uint64_t Total = Nodes.fetch_add(n, std::memory_order_relaxed) + n;
+			if ((MaxNodes > 0u && Total >= MaxNodes) ||
+				(HasDeadline && std::chrono::steady_clock::now() >= Deadline) ||
+				(Token != nullptr && Token->IsCancelled())) Exhausted.store(true, std::memory_order_relaxed);
+			return !IsExhausted();
+		}
+
+		// Count a node searched by a thread, the limits are checked only when the thread completes a chunk of nodes
+		bool Count(NodesCounter& C)
+		{
+			if (++C.Nodes < ChunkNodes) return true;
+			const uint n = C.Nodes;
+			C.Nodes = 0u;
+			return Spend(n);
+		}
+
+		// Add the nodes pending in the thread counter (at the end of a search, limits are not checked)
+		void Flush(NodesCounter& C) { Nodes.fetch_add(C.Nodes, std::memory_order_relaxed); C.Nodes = 0u; }
+
+		bool IsExhausted() const { return Exhausted.load(std::memory_order_relaxed); } // Some limit has been reached
+		uint64_t GetNodes() const { return Nodes.load(std::memory_order_relaxed); } // Nodes searched with this budget
+
+	private:
+		uint64_t MaxNodes; // Maximum number of nodes (0 means no limit)
+		bool HasDeadline; // The deadline is a limit
+		std::chrono::steady_clock::time_point Deadline; // Wall-clock limit
+		const CancellationToken* Token; // Cancellation token (can be nullptr)
+
+		std::atomic<uint64_t> Nodes; // Nodes searched
+		std::atomic<bool> Exhausted; // A limit has been reached
+	};
+}
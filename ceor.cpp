@@ -818,7 +818,7 @@ namespace grcube3
 					if (Algorithm::IsTurn(Lines[sp][n].Last()))
 					{
 						CPLines[sp][n].Insert(0u, Lines[sp][n].Last());
-						while (CPLines[sp][n].Shrink());
+						CPLines[sp][n].ShrinkAll();
 						Lines[sp][n].EraseLast();
 					}
 				}
@@ -1006,6 +1006,7 @@ namespace grcube3
         Report += "2GLL time: " + std::to_string(GetTime2GLL()) + " s\n";
         Report += "Threads: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
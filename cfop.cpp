@@ -103,6 +103,8 @@ namespace grcube3
         DS.AddSearchLevel(L_NoCheck); // Level 2
         for (uint l = 3; l < DepthCrosses; l++) DS.AddSearchLevel(L_Check); // Levels 3 to CrossDepth
 
+        DS.SetPruning(); // Skip the branches that can't reach any solve
+        DS.SetMeetInTheMiddle(); // Join forward and backward halves of the search when possible
         DS.UpdateRootData();
 
         DS.Run(Cores);
@@ -575,7 +577,7 @@ namespace grcube3
                 if (Algorithm::IsTurn(Crosses[CLI][n].Last()))
                 {
                     F2L_1[CLI][n].Insert(0u, Crosses[CLI][n].Last());
-                    while (F2L_1[CLI][n].Shrink());
+                    F2L_1[CLI][n].ShrinkAll();
                     Crosses[CLI][n].EraseLast();
                 }
 
@@ -586,26 +588,26 @@ namespace grcube3
                         if (!A_OLL[CLI].empty())
                         {
                             A_OLL[CLI][n].Insert(0u, F2L_1[CLI][n].Last());
-                            while (A_OLL[CLI][n].Shrink());
+                            A_OLL[CLI][n].ShrinkAll();
                             F2L_1[CLI][n].EraseLast();
                         }
                         else if (!A_1LLL[CLI].empty())
                         {
                             A_1LLL[CLI][n].Insert(0u, F2L_1[CLI][n].Last());
-                            while (A_1LLL[CLI][n].Shrink());
+                            A_1LLL[CLI][n].ShrinkAll();
                             F2L_1[CLI][n].EraseLast();
                         }
                         else if (!EOLL[CLI].empty())
                         {
                             EOLL[CLI][n].Insert(0u, F2L_1[CLI][n].Last());
-                            while (EOLL[CLI][n].Shrink());
+                            EOLL[CLI][n].ShrinkAll();
                             F2L_1[CLI][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_2[CLI][n].Insert(0u, F2L_1[CLI][n].Last());
-                        while (F2L_2[CLI][n].Shrink());
+                        F2L_2[CLI][n].ShrinkAll();
                         F2L_1[CLI][n].EraseLast();
                     }
                 }
@@ -617,26 +619,26 @@ namespace grcube3
                         if (!A_OLL[CLI].empty())
                         {
                             A_OLL[CLI][n].Insert(0u, F2L_2[CLI][n].Last());
-                            while (A_OLL[CLI][n].Shrink());
+                            A_OLL[CLI][n].ShrinkAll();
                             F2L_2[CLI][n].EraseLast();
                         }
                         else if (!A_1LLL[CLI].empty())
                         {
                             A_1LLL[CLI][n].Insert(0u, F2L_2[CLI][n].Last());
-                            while (A_1LLL[CLI][n].Shrink());
+                            A_1LLL[CLI][n].ShrinkAll();
                             F2L_2[CLI][n].EraseLast();
                         }
                         else if (!EOLL[CLI].empty())
                         {
                             EOLL[CLI][n].Insert(0u, F2L_2[CLI][n].Last());
-                            while (EOLL[CLI][n].Shrink());
+                            EOLL[CLI][n].ShrinkAll();
                             F2L_2[CLI][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_3[CLI][n].Insert(0u, F2L_2[CLI][n].Last());
-                        while (F2L_3[CLI][n].Shrink());
+                        F2L_3[CLI][n].ShrinkAll();
                         F2L_2[CLI][n].EraseLast();
                     }
                 }
@@ -648,26 +650,26 @@ namespace grcube3
                         if (!A_OLL[CLI].empty())
                         {
                             A_OLL[CLI][n].Insert(0u, F2L_3[CLI][n].Last());
-                            while (A_OLL[CLI][n].Shrink());
+                            A_OLL[CLI][n].ShrinkAll();
                             F2L_3[CLI][n].EraseLast();
                         }
                         else if (!A_1LLL[CLI].empty())
                         {
                             A_1LLL[CLI][n].Insert(0u, F2L_3[CLI][n].Last());
-                            while (A_1LLL[CLI][n].Shrink());
+                            A_1LLL[CLI][n].ShrinkAll();
                             F2L_3[CLI][n].EraseLast();
                         }
                         else if (!EOLL[CLI].empty())
                         {
                             EOLL[CLI][n].Insert(0u, F2L_3[CLI][n].Last());
-                            while (EOLL[CLI][n].Shrink());
+                            EOLL[CLI][n].ShrinkAll();
                             F2L_3[CLI][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_4[CLI][n].Insert(0u, F2L_3[CLI][n].Last());
-                        while (F2L_4[CLI][n].Shrink());
+                        F2L_4[CLI][n].ShrinkAll();
                         F2L_3[CLI][n].EraseLast();
                     }
                 }
@@ -677,19 +679,19 @@ namespace grcube3
                     if (!A_OLL[CLI].empty())
                     {
                         A_OLL[CLI][n].Insert(0u, F2L_4[CLI][n].Last());
-                        while (A_OLL[CLI][n].Shrink());
+                        A_OLL[CLI][n].ShrinkAll();
                         F2L_4[CLI][n].EraseLast();
                     }
                     else if (!A_1LLL[CLI].empty())
                     {
                         A_1LLL[CLI][n].Insert(0u, F2L_4[CLI][n].Last());
-                        while (A_1LLL[CLI][n].Shrink());
+                        A_1LLL[CLI][n].ShrinkAll();
                         F2L_4[CLI][n].EraseLast();
                     }
                     else if (!EOLL[CLI].empty())
                     {
                         EOLL[CLI][n].Insert(0u, F2L_4[CLI][n].Last());
-                        while (EOLL[CLI][n].Shrink());
+                        EOLL[CLI][n].ShrinkAll();
                         F2L_4[CLI][n].EraseLast();
                     }
                 }
@@ -698,7 +700,7 @@ namespace grcube3
                     if (Algorithm::IsTurn(EOLL[CLI][n].Last()))
                     {
                         A_ZBLL[CLI][n].Insert(0u, EOLL[CLI][n].Last());
-                        while (A_ZBLL[CLI][n].Shrink());
+                        A_ZBLL[CLI][n].ShrinkAll();
                         EOLL[CLI][n].EraseLast();
                     }
                 }
@@ -923,6 +925,7 @@ namespace grcube3
         Report += "Last layer time: " + std::to_string(GetTimeLL()) + " s\n";
         Report += "Threads: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
@@ -26,6 +26,7 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <unordered_map>
 
 #include "collection.h"
 #include "cube.h"
@@ -44,15 +45,18 @@ namespace grcube3
 		if (Cases[CaseIndex].Algs.size() == 1u || Pol == Plc::FIRST) return Cases[CaseIndex].Algs.front(); 
 		
 		uint pos = 0u;
-		if (Pol == Plc::SHORT) // Shortest algorithm for current case
+		if (Pol == Plc::SHORT && SelectionUpdated()) pos = ShortestIndexes[CaseIndex][static_cast<int>(Met)];
+		else if (Pol == Plc::BEST && SelectionUpdated()) pos = BestIndexes[CaseIndex];
+		else if (Pol == Plc::SHORT) // Shortest algorithm for current case
 		{
             float min_size = 0.0f;
             uint n = 0u;
 			for (const auto& A : Cases[CaseIndex].Algs)
 			{
-				if (n == 0u || A.GetMetric(Met) < min_size) 
+				const float size = A.GetMetric(Met);
+				if (n == 0u || size < min_size) 
 				{
-					min_size = A.GetMetric(Met);
+					min_size = size;
 					pos = n;
 				}
 				n++;
@@ -86,6 +90,55 @@ namespace grcube3
 		return Cases[CaseIndex].Algs[pos];
 	}
 	
+	// Update the selected algorithms for all cases
+	void Collection::UpdateSelection()
+	{
+		ClearSelection();
+		for (uint cp = 0u; cp < static_cast<uint>(Cases.size()); cp++) UpdateSelection(cp);
+	}
+
+	// Update the selected algorithms for the given case (the first algorithm with the lower metric / score, all metrics are
+	// computed in a single pass for each algorithm)
+	void Collection::UpdateSelection(const uint cp)
+	{
+		if (cp >= Cases.size() || BestIndexes.size() < cp || ShortestIndexes.size() != BestIndexes.size())
+		{
+			ClearSelection(); // Selection for previous cases is not updated
+			return;
+		}
+		if (BestIndexes.size() == cp)
+		{
+			ShortestIndexes.emplace_back();
+			BestIndexes.push_back(0u);
+		}
+
+		std::array<uint, METRICS_NUMBER>& Shortest = ShortestIndexes[cp];
+		uint& Best = BestIndexes[cp];
+		Shortest.fill(0u);
+		Best = 0u;
+
+		if (Cases[cp].Algs.empty()) return;
+
+		AlgorithmMetrics MinMetrics = Cases[cp].Algs.front().GetMetrics();
+		for (uint n = 1u; n < static_cast<uint>(Cases[cp].Algs.size()); n++)
+		{
+			const AlgorithmMetrics AM = Cases[cp].Algs[n].GetMetrics();
+			for (uint m = 0u; m < METRICS_NUMBER; m++)
+			{
+				if (AM.Values[m] < MinMetrics.Values[m])
+				{
+					MinMetrics.Values[m] = AM.Values[m];
+					Shortest[m] = n;
+				}
+			}
+			if (AM.Score < MinMetrics.Score)
+			{
+				MinMetrics.Score = AM.Score;
+				Best = n;
+			}
+		}
+	}
+
 	// Returns the same algorithm transformed by y turns for getting most comfortable (subjective) movements
 	Algorithm Collection::GetSubjectiveBesty(const Algorithm& A) const
 	{
@@ -169,6 +222,7 @@ namespace grcube3
                 pElementCase = pElementCase->NextSiblingElement("Case");
             }
         }
+        UpdateSelection();
         return !Cases.empty();
     }
 
@@ -222,7 +276,8 @@ namespace grcube3
 	void Collection::OrderAlgorithms()
 	{
 		for (auto& Case : Cases)
-			std::sort(Case.Algs.begin(), Case.Algs.end(), [](auto a, auto b) { return a.GetSize() < b.GetSize(); });
+			std::sort(Case.Algs.begin(), Case.Algs.end(), [](auto a, auto b) { return a.GetSize() < b.GetSize(); });
+		UpdateSelection();
 	}
 
 	// Merge a collection with the current collection
@@ -318,6 +373,7 @@ namespace grcube3
 				}
 			}
 		}	
+		UpdateSelection();
 	}
 
 	// Merge a collection with the list of algorithms from a text file
@@ -439,6 +495,7 @@ namespace grcube3
 				}
 			}
 		}	
+		UpdateSelection();
 	}
 
 	// Check the integrity of the two first layers by the given algorithm
@@ -514,6 +571,26 @@ namespace grcube3
         return false;
     }
 	
+	// Get a key for a last layer (layer in up position) solve algorithm
+	// Two algorithms are equivalent if one is the other with U movements before and after, so the key is the
+	// lowest status key for the algorithm with all the U movements before and after
+	CubeKey Collection::GetLLSolveKey(const Algorithm& Alg)
+	{
+		CubeKey Key = { ~0ull, ~0ull };
+		for (const auto UMov1 : Algorithm::UMovs)
+		{
+			for (const auto UMov2 : Algorithm::UMovs)
+			{
+				Cube CubeAux;
+				CubeAux.ApplyStep(UMov1);
+				CubeAux.ApplyAlgorithm(Alg);
+				CubeAux.ApplyStep(UMov2);
+				if (CubeAux.GetKey() < Key) Key = CubeAux.GetKey();
+			}
+		}
+		return Key;
+	}
+
 	// Check if two last layer corners (layer in up position) solve algorithms are equivalent
 	bool Collection::CheckLLCornersAlgorithms(const Algorithm& AlgA, const Algorithm& AlgB)
 	{
@@ -569,6 +646,35 @@ namespace grcube3
 		for (const auto& Case : Cases) nalgs += static_cast<uint>(Case.Algs.size());
 		faud << "Number of algorithms: " << std::to_string(nalgs) << "\n";
 		
+		// Last layer solve keys for the algorithms, equivalent algorithms are found by key instead of comparing all the pairs
+		const bool SolveProbe = AuditProbe == Probe::LL_SOLVE || AuditProbe == Probe::L5E || AuditProbe == Probe::L5EP;
+		std::vector<std::vector<CubeKey>> SolveKeys; // Key for each case and algorithm
+		std::vector<std::vector<bool>> SolveInvertible; // The algorithm can be inverted (needed for the equivalence check)
+		std::unordered_map<CubeKey, std::vector<std::pair<uint, uint>>> SolveEquivalents; // Case and algorithm for each key
+		if (SolveProbe)
+		{
+			for (uint c = 0u; c < Cases.size(); c++)
+			{
+				SolveKeys.emplace_back();
+				SolveInvertible.emplace_back();
+				for (uint a = 0u; a < Cases[c].Algs.size(); a++)
+				{
+					Algorithm AuxAlg = Cases[c].Algs[a];
+					Cube CubeAux(AuxAlg);
+					if (CubeAux.GetSpin() != Spn::Default)
+					{
+						Stp T1, T2;
+						Cube::GetSpinsSteps(CubeAux.GetSpin(), Spn::Default, T1, T2);
+						if (T1 != Stp::NONE) AuxAlg.Append(T1);
+						if (T2 != Stp::NONE) AuxAlg.Append(T2);
+					}
+					SolveKeys[c].push_back(GetLLSolveKey(AuxAlg));
+					SolveInvertible[c].push_back(AuxAlg.TransformReverseInvert());
+					SolveEquivalents[SolveKeys[c][a]].push_back(std::make_pair(c, a));
+				}
+			}
+		}
+
 		uint nc = 0u; // case number
 		for (const auto& Case : Cases)
 		{
@@ -625,52 +731,23 @@ namespace grcube3
 				}
 				
 				// Equivalent algorithms that solves the last layer
-				if (AuditProbe == Probe::LL_SOLVE || AuditProbe == Probe::L5E || AuditProbe == Probe::L5EP)
-				{	
+				if (SolveProbe)
+				{
+					const bool Invertible = SolveInvertible[nc][na];
+					const CubeKey& Key = SolveKeys[nc][na];
+
 					// Compare with same case algorithms
-					uint nab = 0u; // b algorithm number
-					for (const auto& AlgB : Case.Algs)
+					for (uint nab = 0u; nab < Case.Algs.size(); nab++) // b algorithm number
 					{
-						Algorithm AuxAlgB = AlgB;
-						Cube CubeAuxB(AuxAlgB);
-						if (CubeAuxB.GetSpin() != Spn::Default)
-						{
-							Stp T1, T2;
-							Cube::GetSpinsSteps(CubeAuxB.GetSpin(), Spn::Default, T1, T2);
-							if (T1 != Stp::NONE) AuxAlgB.Append(T1);
-							if (T2 != Stp::NONE) AuxAlgB.Append(T2);
-						}
-
-						if (&Alg != &AlgB && !CheckLLSolveAlgorithms(AuxAlg, AuxAlgB)) 
-							faud << "\t\tNot equivalent solve alg #" << nc << "." << nab << ": " << AlgB.ToString() << "\n";
-						nab++;
+						if (nab != na && (!Invertible || SolveKeys[nc][nab] != Key))
+							faud << "\t\tNot equivalent solve alg #" << nc << "." << nab << ": " << Case.Algs[nab].ToString() << "\n";
 					}
 
-					// Compare with other cases algorithms
-					uint noc = 0u; // other case number
-					for (const auto& OtherCase : Cases)
+					// Compare with other cases algorithms (only the algorithms with the same key)
+					if (Invertible)
 					{
-						if (&Case != &OtherCase)
-						{
-							uint noa = 0u; // other algorithm number
-							for (const auto& OtherAlg : OtherCase.Algs)
-							{
-								Algorithm AuxAlgB = OtherAlg;
-								Cube CubeAuxB(AuxAlgB);
-								if (CubeAuxB.GetSpin() != Spn::Default)
-								{
-									Stp T1, T2;
-									Cube::GetSpinsSteps(CubeAuxB.GetSpin(), Spn::Default, T1, T2);
-									if (T1 != Stp::NONE) AuxAlgB.Append(T1);
-									if (T2 != Stp::NONE) AuxAlgB.Append(T2);
-								}
-
-								if (CheckLLSolveAlgorithms(AuxAlg, AuxAlgB))
-									faud << "\t\tEquivalent solve alg #" << noc << "." << noa << ": " << OtherAlg.ToString() << "\n";
-								noa++;
-							}
-						}
-						noc++;
+						for (const auto& E : SolveEquivalents[Key]) if (E.first != nc)
+							faud << "\t\tEquivalent solve alg #" << E.first << "." << E.second << ": " << Cases[E.first].Algs[E.second].ToString() << "\n";
 					}
 				}
 				
@@ -24,9 +24,11 @@
 
 #include <string>
 #include <vector>
+#include <array>
 
 #include "cube_definitions.h"
 #include "algorithm.h"
+#include "cube.h"
 
 namespace grcube3
 {
@@ -59,11 +61,11 @@ namespace grcube3
         Collection(const std::string& s, bool clean) { LoadXMLCollectionFile(s, clean); } // Initialize algorithms collection
         ~Collection() { } // Destructor
 		
-		Algorithm& operator[](const uint cn) { return Cases[cn].Algs.front(); }
+		Algorithm& operator[](const uint cn) { ClearSelection(); return Cases[cn].Algs.front(); } // The algorithm can be changed
 
-		void AddData(const Case& CData) { Cases.push_back(CData); }
+		void AddData(const Case& CData) { Cases.push_back(CData); UpdateSelection(static_cast<uint>(Cases.size()) - 1u); }
 		
-		void Reset() { Name.clear(); Description.clear(); Cases.clear(); }
+		void Reset() { Name.clear(); Description.clear(); Cases.clear(); ClearSelection(); }
 
 		std::string GetName() const { return Name; }
 		
@@ -81,6 +83,7 @@ namespace grcube3
         {
             if (cp >= Cases.size() || ap >= Cases[cp].Algs.size()) return false;
             Cases[cp].Algs[ap] = alg;
+            UpdateSelection(cp);
             return true;
         }
 
@@ -89,6 +92,7 @@ namespace grcube3
             if (cp >= Cases.size()) return false;
             for (const auto& a : Cases[cp].Algs) if (a == alg) return true; // Algortihm already present in collection
             Cases[cp].Algs.push_back(alg);
+            UpdateSelection(cp);
             return true;
         }
 
@@ -142,6 +146,9 @@ namespace grcube3
 
 		// Check if two last layer solve algorithms are equivalent
         static bool CheckLLSolveAlgorithms(const Algorithm&, const Algorithm&);
+
+		// Get a key for a last layer solve algorithm, equivalent algorithms have the same key
+		static CubeKey GetLLSolveKey(const Algorithm&);
 		
 		// Check if two last layer orientation algorithms are equivalent
         static bool CheckLLOrientAlgorithms(const Algorithm&, const Algorithm&);
@@ -156,5 +163,15 @@ namespace grcube3
         std::string Name; // Algorithms collection name
         std::string Description; // Algorithms collection description
         std::vector<Case> Cases; // Algorithms collection cases
+
+        // Selected algorithms for each case, computed with the collection changes: the shortest algorithm for each metric and the
+        // algorithm with the best subjective score (if the selection is not updated, the case algorithms are checked)
+        std::vector<std::array<uint, METRICS_NUMBER>> ShortestIndexes;
+        std::vector<uint> BestIndexes;
+
+        bool SelectionUpdated() const { return ShortestIndexes.size() == Cases.size() && BestIndexes.size() == Cases.size(); }
+        void ClearSelection() { ShortestIndexes.clear(); BestIndexes.clear(); }
+        void UpdateSelection(); // Update the selected algorithms for all cases
+        void UpdateSelection(const uint); // Update the selected algorithms for the given case
 	};
 }
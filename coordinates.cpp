@@ -0,0 +1,279 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "coordinates.h"
+
+namespace grcube3
+{
+	std::map<std::pair<std::vector<Edg>, bool>, std::unique_ptr<CoordinateTable>> CoordinateTable::EdgesTables; // Initialize static variables
+	std::mutex CoordinateTable::EdgesTablesMutex;
+
+	// Edges status with the given orientation and the edges in their positions
+	S64 Coordinates::GetEdgesFromEO(const uint EO)
+	{
+		S64 Dirs = EO & 0x7FFu, Parity = 0u;
+		for (uint p = 0u; p < 11u; p++) Parity ^= (Dirs >> p) & 0x1u;
+		Dirs |= Parity << 11;
+		return (Cube().GetEdgesStatus() & 0x0000FFFFFFFFFFFFULL) | (Dirs << 48);
+	}
+
+	// Corner twist for a direction in a position: positions UFR, UBL, DFL and DBR have twist 1 for FB direction, the others for RL direction
+	uint Coordinates::GetCornerTwist(const uint Pos, const uint Dir)
+	{
+		if (Dir == 0u) return 0u;
+		const bool Tetrad = Pos == 0u || Pos == 2u || Pos == 5u || Pos == 7u;
+		return Tetrad == (Dir == 1u) ? 1u : 2u;
+	}
+
+	// Corner direction for a twist in a position (inverse of GetCornerTwist)
+	uint Coordinates::GetCornerDir(const uint Pos, const uint Twist)
+	{
+		if (Twist == 0u) return 0u;
+		const bool Tetrad = Pos == 0u || Pos == 2u || Pos == 5u || Pos == 7u;
+		return Tetrad == (Twist == 1u) ? 1u : 2u;
+	}
+
+	// Corners orientation (twists of the first seven corner positions)
+	uint Coordinates::GetCO(const S64 Corners)
+	{
+		uint CO = 0u;
+		for (uint p = 0u; p < 7u; p++) CO = CO * 3u + GetCornerTwist(p, (Corners >> (8u * p + 4u)) & 0x3u);
+		return CO;
+	}
+
+	// Corners status with the given orientation and the corners in their positions
+	S64 Coordinates::GetCornersFromCO(const uint CO)
+	{
+		S64 Corners = Cube().GetCornersStatus();
+		uint Aux = CO, Sum = 0u;
+		for (uint p = 7u; p-- > 0u;)
+		{
+			const uint Twist = Aux % 3u;
+			Aux /= 3u;
+			Sum += Twist;
+			Corners |= static_cast<S64>(GetCornerDir(p, Twist)) << (8u * p + 4u);
+		}
+		return Corners | (static_cast<S64>(GetCornerDir(7u, (3u - Sum % 3u) % 3u)) << 60);
+	}
+
+	// Corners permutation (Lehmer code)
+	uint Coordinates::GetCP(const S64 Corners)
+	{
+		uint CP = 0u;
+		for (uint p = 0u; p < 8u; p++)
+		{
+			const uint Corner = (Corners >> (8u * p)) & 0x7u;
+			uint Smaller = 0u; // Corners lower than the current one in the next positions
+			for (uint q = p + 1u; q < 8u; q++) if (((Corners >> (8u * q)) & 0x7u) < Corner) Smaller++;
+			CP = CP * (8u - p) + Smaller;
+		}
+		return CP;
+	}
+
+	// Corners status with the given permutation
+	S64 Coordinates::GetCornersFromCP(const uint CP)
+	{
+		uint Digits[8], Aux = CP;
+		for (uint p = 8u; p-- > 0u;)
+		{
+			Digits[p] = Aux % (8u - p);
+			Aux /= 8u - p;
+		}
+
+		std::vector<uint> Free = { 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u }; // Corners not placed yet
+		S64 Corners = 0u;
+		for (uint p = 0u; p < 8u; p++)
+		{
+			Corners |= static_cast<S64>(Free[Digits[p]]) << (8u * p);
+			Free.erase(Free.begin() + Digits[p]);
+		}
+		return Corners;
+	}
+
+	// UD slice (combinatorial number system for the positions of the E layer edges)
+	uint Coordinates::GetUDSlice(const S64 Edges)
+	{
+		uint Slice = 0u, k = 0u;
+		for (uint p = 0u; p < 12u; p++)
+			if (((Edges >> (4u * p)) & 0xFu) < 4u) Slice += Binomial(p, ++k); // FR, FL, BL and BR are the edges 0 to 3
+		return Slice;
+	}
+
+	// Edges status with the E layer edges in the given positions
+	S64 Coordinates::GetEdgesFromUDSlice(const uint Slice)
+	{
+		bool InSlice[12] = { false };
+		uint Aux = Slice;
+		for (uint k = 4u, p = 12u; k > 0u; k--) // Greatest position with a binomial not greater than the rest
+		{
+			do p--; while (Binomial(p, k) > Aux);
+			Aux -= Binomial(p, k);
+			InSlice[p] = true;
+		}
+
+		S64 Edges = 0u;
+		uint SliceEdge = 0u, OtherEdge = 4u;
+		for (uint p = 0u; p < 12u; p++) Edges |= static_cast<S64>(InSlice[p] ? SliceEdge++ : OtherEdge++) << (4u * p);
+		return Edges;
+	}
+
+	// Size for a partial edges permutation
+	uint Coordinates::GetEdgesPermutationSize(const uint NumEdges, const bool Directions)
+	{
+		return Factorial(12u) / Factorial(12u - NumEdges) * (Directions ? 1u << NumEdges : 1u);
+	}
+
+	// Partial edges permutation: each edge position is ranked between the positions still free
+	uint Coordinates::GetEdgesPermutation(const S64 Edges, const std::vector<Edg>& EdgesList, const bool Directions)
+	{
+		uint Positions[12], Dirs = 0u;
+		for (uint p = 0u; p < 12u; p++)
+		{
+			const uint Edge = (Edges >> (4u * p)) & 0xFu;
+			Positions[Edge] = p;
+		}
+
+		uint Perm = 0u, Used = 0u;
+		for (uint n = 0u; n < EdgesList.size(); n++)
+		{
+			const uint Pos = Positions[static_cast<uint>(EdgesList[n])];
+			uint Rank = 0u; // Free positions before the edge position
+			for (uint p = 0u; p < Pos; p++) if (!((Used >> p) & 0x1u)) Rank++;
+			Used |= 1u << Pos;
+			Perm = Perm * (12u - n) + Rank;
+			Dirs = (Dirs << 1) | static_cast<uint>((Edges >> (48u + Pos)) & 0x1u);
+		}
+		return Directions ? (Perm << EdgesList.size()) | Dirs : Perm;
+	}
+
+	// Edges status with the given edges in the positions of the partial edges permutation
+	S64 Coordinates::GetEdgesFromPermutation(const uint Coord, const std::vector<Edg>& EdgesList, const bool Directions)
+	{
+		const uint NumEdges = static_cast<uint>(EdgesList.size());
+		uint Perm = Directions ? Coord >> NumEdges : Coord, Dirs = Directions ? Coord & ((1u << NumEdges) - 1u) : 0u;
+
+		uint Ranks[12];
+		for (uint n = NumEdges; n-- > 0u;)
+		{
+			Ranks[n] = Perm % (12u - n);
+			Perm /= 12u - n;
+		}
+
+		int Edge[12]; // Edge in each position (-1 if free)
+		bool Placed[12] = { false };
+		for (auto& e : Edge) e = -1;
+
+		S64 Edges = 0u;
+		for (uint n = 0u; n < NumEdges; n++)
+		{
+			uint Pos = 0u;
+			for (uint Rank = Ranks[n]; Edge[Pos] >= 0 || Rank > 0u; Pos++) if (Edge[Pos] < 0) Rank--; // Position with the given rank between the free ones
+			Edge[Pos] = static_cast<int>(EdgesList[n]);
+			Placed[static_cast<uint>(EdgesList[n])] = true;
+			Edges |= static_cast<S64>((Dirs >> (NumEdges - 1u - n)) & 0x1u) << (48u + Pos);
+		}
+
+		uint Other = 0u; // Other edges in the free positions
+		for (uint p = 0u; p < 12u; p++)
+		{
+			if (Edge[p] < 0)
+			{
+				while (Placed[Other]) Other++;
+				Edge[p] = static_cast<int>(Other++);
+			}
+			Edges |= static_cast<S64>(Edge[p]) << (4u * p);
+		}
+		return Edges;
+	}
+
+	uint Coordinates::Factorial(const uint n) { return n < 2u ? 1u : n * Factorial(n - 1u); }
+
+	uint Coordinates::Binomial(const uint n, const uint k)
+	{
+		if (k > n) return 0u;
+		uint B = 1u;
+		for (uint i = 1u; i <= k; i++) B = B * (n - k + i) / i;
+		return B;
+	}
+
+	// Build the transitions table: each coordinate is set in a cube, turned and read again
+	CoordinateTable::CoordinateTable(const uint CoordSize, const GetFunction& Get, const SetFunction& Set)
+	{
+		Size = CoordSize;
+		Moves.resize(static_cast<size_t>(Size) * 18u);
+
+		for (uint Coord = 0u; Coord < Size; Coord++)
+		{
+			Cube C;
+			Set(Coord, C);
+			for (uint m = 0u; m < 18u; m++)
+			{
+				Cube C2 = C;
+				C2.ApplyStep(static_cast<Stp>(static_cast<uint>(Stp::U) + m));
+				Moves[static_cast<size_t>(Coord) * 18u + m] = Get(C2);
+			}
+		}
+	}
+
+	const CoordinateTable& CoordinateTable::GetEOTable()
+	{
+		static const CoordinateTable EOTable(Coordinates::EO_SIZE,
+			[](const Cube& C) { return Coordinates::GetEO(C.GetEdgesStatus()); },
+			[](const uint Coord, Cube& C) { C.SetStatus(Coordinates::GetEdgesFromEO(Coord), C.GetCornersStatus()); });
+		return EOTable;
+	}
+
+	const CoordinateTable& CoordinateTable::GetCOTable()
+	{
+		static const CoordinateTable COTable(Coordinates::CO_SIZE,
+			[](const Cube& C) { return Coordinates::GetCO(C.GetCornersStatus()); },
+			[](const uint Coord, Cube& C) { C.SetStatus(C.GetEdgesStatus(), Coordinates::GetCornersFromCO(Coord)); });
+		return COTable;
+	}
+
+	const CoordinateTable& CoordinateTable::GetCPTable()
+	{
+		static const CoordinateTable CPTable(Coordinates::CP_SIZE,
+			[](const Cube& C) { return Coordinates::GetCP(C.GetCornersStatus()); },
+			[](const uint Coord, Cube& C) { C.SetStatus(C.GetEdgesStatus(), Coordinates::GetCornersFromCP(Coord)); });
+		return CPTable;
+	}
+
+	const CoordinateTable& CoordinateTable::GetUDSliceTable()
+	{
+		static const CoordinateTable UDSliceTable(Coordinates::UD_SLICE_SIZE,
+			[](const Cube& C) { return Coordinates::GetUDSlice(C.GetEdgesStatus()); },
+			[](const uint Coord, Cube& C) { C.SetStatus(Coordinates::GetEdgesFromUDSlice(Coord), C.GetCornersStatus()); });
+		return UDSliceTable;
+	}
+
+	// Get the table for the given partial edges permutation (built if it's not already built)
+	const CoordinateTable* CoordinateTable::GetEdgesPermutationTable(const std::vector<Edg>& EdgesList, const bool Directions)
+	{
+		std::lock_guard<std::mutex> guard(EdgesTablesMutex); // Thread safe code
+		auto& T = EdgesTables[std::make_pair(EdgesList, Directions)];
+		if (T == nullptr) T.reset(new CoordinateTable(Coordinates::GetEdgesPermutationSize(static_cast<uint>(EdgesList.size()), Directions),
+			[EdgesList, Directions](const Cube& C) { return Coordinates::GetEdgesPermutation(C.GetEdgesStatus(), EdgesList, Directions); },
+			[EdgesList, Directions](const uint Coord, Cube& C) { C.SetStatus(Coordinates::GetEdgesFromPermutation(Coord, EdgesList, Directions), C.GetCornersStatus()); }));
+		return T.get();
+	}
+}
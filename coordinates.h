@@ -0,0 +1,117 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+
+#include "cube.h"
+
+namespace grcube3
+{
+	// Cube coordinates: compact integers (0 to size - 1) for a property of the edges or corners status
+	// Coordinates are absolute (cube spin is not used), as the edges and corners status
+	class Coordinates
+	{
+	public:
+		static constexpr uint EO_SIZE = 2048u; // 2^11 edges orientations
+		static constexpr uint CO_SIZE = 2187u; // 3^7 corners orientations
+		static constexpr uint CP_SIZE = 40320u; // 8! corners permutations
+		static constexpr uint UD_SLICE_SIZE = 495u; // 12 choose 4 positions for the E layer edges
+
+		// Edges orientation: direction bits of the first eleven edge positions (the last one is given by the parity)
+		static uint GetEO(const S64 Edges) { return static_cast<uint>((Edges >> 48) & 0x7FFu); }
+
+		// Edges status with the given orientation and the edges in their positions
+		static S64 GetEdgesFromEO(const uint);
+
+		// Corners orientation: twist of the first seven corner positions as base 3 digits (the last one is given by the other twists)
+		// The twist is 0 for UD direction and 1 or 2 for the others, depending on the position (clockwise is 1)
+		static uint GetCO(const S64 Corners);
+
+		// Corners status with the given orientation and the corners in their positions
+		static S64 GetCornersFromCO(const uint);
+
+		// Corners permutation: lexicographic rank (Lehmer code) of the corners in the positions
+		static uint GetCP(const S64 Corners);
+
+		// Corners status with the given permutation and UD directions
+		static S64 GetCornersFromCP(const uint);
+
+		// UD slice: rank of the set of positions of the E layer edges (FR, FL, BL and BR), 0 when they are in the E layer
+		static uint GetUDSlice(const S64 Edges);
+
+		// Edges status with the E layer edges in the given positions (other edges in order, all with positive direction)
+		static S64 GetEdgesFromUDSlice(const uint);
+
+		// Partial edges permutation: rank of the positions (and directions if required) of the given edges, in the given order
+		static uint GetEdgesPermutationSize(const uint NumEdges, const bool Directions);
+		static uint GetEdgesPermutation(const S64 Edges, const std::vector<Edg>&, const bool Directions);
+
+		// Edges status with the given edges in the positions of the coordinate (other edges in the free positions, in order)
+		static S64 GetEdgesFromPermutation(const uint, const std::vector<Edg>&, const bool Directions);
+
+	private:
+		static uint Factorial(const uint);
+		static uint Binomial(const uint, const uint);
+		static uint GetCornerTwist(const uint Pos, const uint Dir);
+		static uint GetCornerDir(const uint Pos, const uint Twist);
+	};
+
+	// Coordinate transitions for the 18 face turns (Stp::U to Stp::L2), from a coordinate to the next one
+	class CoordinateTable
+	{
+	public:
+		typedef std::function<uint(const Cube&)> GetFunction; // Coordinate for a cube
+		typedef std::function<void(const uint, Cube&)> SetFunction; // Cube with the coordinate (other pieces don't care)
+
+		// Build the table for a coordinate with the given size
+		CoordinateTable(const uint, const GetFunction&, const SetFunction&);
+
+		// Size of the coordinate
+		uint GetSize() const { return Size; }
+
+		// Get the coordinate after a face turn
+		uint Move(const uint Coord, const Stp S) const { return Moves[Coord * 18u + static_cast<uint>(S) - static_cast<uint>(Stp::U)]; }
+
+		// Tables for the predefined coordinates (built only once and shared)
+		static const CoordinateTable& GetEOTable();
+		static const CoordinateTable& GetCOTable();
+		static const CoordinateTable& GetCPTable();
+		static const CoordinateTable& GetUDSliceTable();
+
+		// Table for a partial edges permutation (built only once for each edges list)
+		static const CoordinateTable* GetEdgesPermutationTable(const std::vector<Edg>&, const bool Directions);
+
+	private:
+		uint Size; // Coordinate size
+		std::vector<uint32_t> Moves; // Next coordinate for each coordinate and face turn
+
+		static std::map<std::pair<std::vector<Edg>, bool>, std::unique_ptr<CoordinateTable>> EdgesTables; // Built partial edges permutation tables
+		static std::mutex EdgesTablesMutex; // Mutex for the built partial edges permutation tables
+	};
+}
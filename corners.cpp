@@ -180,37 +180,8 @@ namespace grcube3
 		{ Stc::DBR_B, Stc::DBR_R, Stc::DBR_D }  // DBR
 	};
 
-    // Piece positions from spin and absolut corner positions
-    const Cnp c_Corners::cnp_Absolut[24][8] =
-    { //     UFR       UFL       UBL       UBR       DFR       DFL       DBL       DBR
-        { Cnp::UFR, Cnp::UFL, Cnp::UBL, Cnp::UBR, Cnp::DFR, Cnp::DFL, Cnp::DBL, Cnp::DBR }, // UF
-        { Cnp::UBR, Cnp::UFR, Cnp::UFL, Cnp::UBL, Cnp::DBR, Cnp::DFR, Cnp::DFL, Cnp::DBL }, // UR
-        { Cnp::UBL, Cnp::UBR, Cnp::UFR, Cnp::UFL, Cnp::DBL, Cnp::DBR, Cnp::DFR, Cnp::DFL }, // UB
-        { Cnp::UFL, Cnp::UBL, Cnp::UBR, Cnp::UFR, Cnp::DFL, Cnp::DBL, Cnp::DBR, Cnp::DFR }, // UL
-        { Cnp::DFL, Cnp::DFR, Cnp::DBR, Cnp::DBL, Cnp::UFL, Cnp::UFR, Cnp::UBR, Cnp::UBL }, // DF
-        { Cnp::DFR, Cnp::DBR, Cnp::DBL, Cnp::DFL, Cnp::UFR, Cnp::UBR, Cnp::UBL, Cnp::UFL }, // DR
-        { Cnp::DBR, Cnp::DBL, Cnp::DFL, Cnp::DFR, Cnp::UBR, Cnp::UBL, Cnp::UFL, Cnp::UFR }, // DB
-        { Cnp::DBL, Cnp::DFL, Cnp::DFR, Cnp::DBR, Cnp::UBL, Cnp::UFL, Cnp::UFR, Cnp::UBR }, // DL
-        { Cnp::UFL, Cnp::UFR, Cnp::DFR, Cnp::DFL, Cnp::UBL, Cnp::UBR, Cnp::DBR, Cnp::DBL }, // FU
-        { Cnp::UFR, Cnp::DFR, Cnp::DFL, Cnp::UFL, Cnp::UBR, Cnp::DBR, Cnp::DBL, Cnp::UBL }, // FR
-        { Cnp::DFR, Cnp::DFL, Cnp::UFL, Cnp::UFR, Cnp::DBR, Cnp::DBL, Cnp::UBL, Cnp::UBR }, // FD
-        { Cnp::DFL, Cnp::UFL, Cnp::UFR, Cnp::DFR, Cnp::DBL, Cnp::UBL, Cnp::UBR, Cnp::DBR }, // FL
-        { Cnp::UBR, Cnp::UBL, Cnp::DBL, Cnp::DBR, Cnp::UFR, Cnp::UFL, Cnp::DFL, Cnp::DFR }, // BU
-        { Cnp::DBR, Cnp::UBR, Cnp::UBL, Cnp::DBL, Cnp::DFR, Cnp::UFR, Cnp::UFL, Cnp::DFL }, // BR
-        { Cnp::DBL, Cnp::DBR, Cnp::UBR, Cnp::UBL, Cnp::DFL, Cnp::DFR, Cnp::UFR, Cnp::UFL }, // BD
-        { Cnp::UBL, Cnp::DBL, Cnp::DBR, Cnp::UBR, Cnp::UFL, Cnp::DFL, Cnp::DFR, Cnp::UFR }, // BL
-        { Cnp::UFR, Cnp::UBR, Cnp::DBR, Cnp::DFR, Cnp::UFL, Cnp::UBL, Cnp::DBL, Cnp::DFL }, // RU
-        { Cnp::DFR, Cnp::UFR, Cnp::UBR, Cnp::DBR, Cnp::DFL, Cnp::UFL, Cnp::UBL, Cnp::DBL }, // RF
-        { Cnp::DBR, Cnp::DFR, Cnp::UFR, Cnp::UBR, Cnp::DBL, Cnp::DFL, Cnp::UFL, Cnp::UBL }, // RD
-        { Cnp::UBR, Cnp::DBR, Cnp::DFR, Cnp::UFR, Cnp::UBL, Cnp::DBL, Cnp::DFL, Cnp::UFL }, // RB
-        { Cnp::UBL, Cnp::UFL, Cnp::DFL, Cnp::DBL, Cnp::UBR, Cnp::UFR, Cnp::DFR, Cnp::DBR }, // LU
-        { Cnp::UFL, Cnp::DFL, Cnp::DBL, Cnp::UBL, Cnp::UFR, Cnp::DFR, Cnp::DBR, Cnp::UBR }, // LF
-        { Cnp::DFL, Cnp::DBL, Cnp::UBL, Cnp::UFL, Cnp::DFR, Cnp::DBR, Cnp::UBR, Cnp::UFR }, // LD
-        { Cnp::DBL, Cnp::UBL, Cnp::UFL, Cnp::DFL, Cnp::DBR, Cnp::UBR, Cnp::UFR, Cnp::DFR }  // LB
-    };
-
     // Absolute corner positions from spin and corner positions
-    const Acp c_Corners::acp_Positions[24][8] =
+    constexpr Acp c_Corners::acp_Positions[24][8] =
     { //     UFR       UFL       UBL       UBR       DFR       DFL       DBL       DBR
         { Acp::UFR, Acp::UFL, Acp::UBL, Acp::UBR, Acp::DFR, Acp::DFL, Acp::DBL, Acp::DBR }, // UF
         { Acp::UFL, Acp::UBL, Acp::UBR, Acp::UFR, Acp::DFL, Acp::DBL, Acp::DBR, Acp::DFR }, // UR
@@ -238,1175 +209,140 @@ namespace grcube3
         { Acp::DBL, Acp::UBL, Acp::UFL, Acp::DFL, Acp::DBR, Acp::UBR, Acp::UFR, Acp::DFR }  // LB
     };
 
-    const Cnd c_Corners::cnd_OrientationUD[24][8][8] = // Corners directions for UD orientation
-    {
-        // Spin UF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin UR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin UB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin UL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin DF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin DR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin DB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin DL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // FL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UF
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UL
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UB
-             { Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, Cnd::UD, }, // UR
-        },
-        // Spin FU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin FR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin FD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin FL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin BU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin BR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin BD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin BL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UF
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UB
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UR
-        },
-        // Spin RU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin RF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin RD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin RB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin LU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin LF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin LD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
-        // Spin LB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UF
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UB
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UR
-        },
+    // Corner positions from spin and absolut corner positions
+    constexpr FixedTable2<Cnp, 24, 8> c_Corners::cnp_Absolut = InverseTable<Cnp>(acp_Positions);
+
+    // Corners directions (UD, FB, RL orientations) for the spins with the U/D, F/B or R/L faces up, for the spins with even
+    // or odd index and for corners out of or in the tetrad (UFR, UBL, DFL and DBR or the other four) of the position
+    static constexpr Cnd s_Directions[3][2][2][3] =
+    { //   Out of the tetrad              In the tetrad
+        { { { Cnd::UD, Cnd::FB, Cnd::RL }, { Cnd::UD, Cnd::RL, Cnd::FB } },   // UF, UB, DF, DB
+          { { Cnd::UD, Cnd::RL, Cnd::FB }, { Cnd::UD, Cnd::FB, Cnd::RL } } }, // UR, UL, DR, DL
+        { { { Cnd::RL, Cnd::FB, Cnd::UD }, { Cnd::UD, Cnd::FB, Cnd::RL } },   // FU, FD, BU, BD
+          { { Cnd::RL, Cnd::UD, Cnd::FB }, { Cnd::UD, Cnd::RL, Cnd::FB } } }, // FR, FL, BR, BL
+        { { { Cnd::FB, Cnd::RL, Cnd::UD }, { Cnd::UD, Cnd::RL, Cnd::FB } },   // RU, RD, LU, LD
+          { { Cnd::FB, Cnd::UD, Cnd::RL }, { Cnd::UD, Cnd::FB, Cnd::RL } } }  // RF, RB, LF, LB
     };
 
-    const Cnd c_Corners::cnd_OrientationFB[24][8][8] = // Corners directions for FB orientation
+    // Corner positions in the UFR, UBL, DFL and DBR tetrad
+    static constexpr uint s_Tetrad[8] = { 1u, 0u, 1u, 0u, 0u, 1u, 0u, 1u };
+
+    // Corners directions for an orientation (0 for UD, 1 for FB, 2 for RL) for each spin, corner position and corner
+    static constexpr FixedTable3<Cnd, 24, 8, 8> Orientation(const uint O)
     {
-        // Spin UF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin UR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin UB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin UL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin DF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin DR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin DB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin DL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin FU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin FR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin FD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin FL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin BU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin BR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin BD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin BL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin RU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin RF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin RD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin RB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin LU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin LF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin LD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin LB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-    };
+        FixedTable3<Cnd, 24, 8, 8> Dirs{};
+        for (uint sp = 0u; sp < 24u; sp++)
+            for (uint p = 0u; p < 8u; p++)
+                for (uint c = 0u; c < 8u; c++)
+                    Dirs[sp][p][c] = s_Directions[sp / 8u][sp % 2u][s_Tetrad[p] == s_Tetrad[c] ? 1u : 0u][O];
+        return Dirs;
+    }
+
+    constexpr FixedTable3<Cnd, 24, 8, 8> c_Corners::cnd_OrientationUD = Orientation(0u);
+    constexpr FixedTable3<Cnd, 24, 8, 8> c_Corners::cnd_OrientationFB = Orientation(1u);
+    constexpr FixedTable3<Cnd, 24, 8, 8> c_Corners::cnd_OrientationRL = Orientation(2u);
 
-    const Cnd c_Corners::cnd_OrientationRL[24][8][8] = // Corners directions for RL orientation
+    // UD orientation for each spin as bits operations (direction for corners out of their tetrad: UD, RL or FB)
+    const c_Corners::CornersOrientation c_Corners::c_Orientation[24] =
     {
-        // Spin UF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin UR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin UB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin UL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin DF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin DR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin DB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UF
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UB
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UR
-        },
-        // Spin DL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // FR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // FL
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // BL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UF
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UL
-             { Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, }, // UB
-             { Cnd::RL, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::FB, Cnd::RL, Cnd::FB, Cnd::RL, }, // UR
-        },
-        // Spin FU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin FR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin FD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin FL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin BU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin BR
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin BD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // FR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // FL
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // BL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UF
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UL
-             { Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, }, // UB
-             { Cnd::RL, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::UD, Cnd::RL, Cnd::UD, Cnd::RL, }, // UR
-        },
-        // Spin BL
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // FL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // BR
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UF
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UL
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UB
-             { Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, Cnd::FB, }, // UR
-        },
-        // Spin RU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin RF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin RD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin RB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin LU
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin LF
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
-        // Spin LD
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // FR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // FL
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // BL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // BR
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UF
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UL
-             { Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, }, // UB
-             { Cnd::FB, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::UD, Cnd::FB, Cnd::UD, Cnd::FB, }, // UR
-        },
-        // Spin LB
-        { //     UFR      UFL      UBL      UBR      DFR      DFL      DBL      DBR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // FL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // BR
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UF
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UL
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UB
-             { Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, Cnd::RL, }, // UR
-        },
+        { 0x0000000000000000ULL, 4 }, // UF
+        { 0x0000000000000000ULL, 4 }, // UR
+        { 0x0000000000000000ULL, 4 }, // UB
+        { 0x0000000000000000ULL, 4 }, // UL
+        { 0x0000000000000000ULL, 4 }, // DF
+        { 0x0000000000000000ULL, 4 }, // DR
+        { 0x0000000000000000ULL, 4 }, // DB
+        { 0x0000000000000000ULL, 4 }, // DL
+        { 0x0101010101010101ULL, 5 }, // FU
+        { 0x0101010101010101ULL, 5 }, // FR
+        { 0x0101010101010101ULL, 5 }, // FD
+        { 0x0101010101010101ULL, 5 }, // FL
+        { 0x0101010101010101ULL, 5 }, // BU
+        { 0x0101010101010101ULL, 5 }, // BR
+        { 0x0101010101010101ULL, 5 }, // BD
+        { 0x0101010101010101ULL, 5 }, // BL
+        { 0x0101010101010101ULL, 4 }, // RU
+        { 0x0101010101010101ULL, 4 }, // RF
+        { 0x0101010101010101ULL, 4 }, // RD
+        { 0x0101010101010101ULL, 4 }, // RB
+        { 0x0101010101010101ULL, 4 }, // LU
+        { 0x0101010101010101ULL, 4 }, // LF
+        { 0x0101010101010101ULL, 4 }, // LD
+        { 0x0101010101010101ULL, 4 }  // LB
     };
 
-	void c_Corners::c_U() // U
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_UBR());
-		PutStatus_UBR(GetStatus_UBL());
-		PutStatus_UBL(GetStatus_UFL());
-		PutStatus_UFL(buffer);
-
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFR(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFL(CORNER_DIR_FB);
-	
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBL(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBR(CORNER_DIR_FB);
-	}
-	
-	void c_Corners::c_U2() // U2
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_UBL());
-		PutStatus_UBL(buffer);
-	
-		buffer = GetStatus_UFL();
-		PutStatus_UFL(GetStatus_UBR());
-		PutStatus_UBR(buffer);
-	}
-	
-	void c_Corners::c_Up() // U'
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_UFL());
-		PutStatus_UFL(GetStatus_UBL());
-		PutStatus_UBL(GetStatus_UBR());
-		PutStatus_UBR(buffer);
+	// Face turns as bits permutations of the corners status, from Stp::NONE to Stp::L2
+	const c_Corners::CornersTurn c_Corners::c_Turns[19] =
+	{ //      Keep                   Masks (bytes moved by the same rotation)                                                     Rotations          Twist (b0 from b0, b0 from b1, b1 from b0, b1 from b1, b0 toggle, b1 toggle)
+		{ 0x3737373737373737ULL, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  0,  0,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // NONE
+		{ 0x3737373700000000ULL, { 0x0000000000373737ULL, 0x0000000037000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  8, 40,  0,  0 }, { 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // U
+		{ 0x3737373700000000ULL, { 0x0000000000000037ULL, 0x0000000037373700ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 24, 56,  0,  0 }, { 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000001010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // U'
+		{ 0x3737373700000000ULL, { 0x0000000000003737ULL, 0x0000000037370000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 16, 48,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // U2
+		{ 0x0000000037373737ULL, { 0x0000003700000000ULL, 0x3737370000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 24, 56,  0,  0 }, { 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // D
+		{ 0x0000000037373737ULL, { 0x0037373700000000ULL, 0x3700000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  8, 40,  0,  0 }, { 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0101010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // D'
+		{ 0x0000000037373737ULL, { 0x0000373700000000ULL, 0x3737000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 16, 48,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // D2
+		{ 0x3737000037370000ULL, { 0x0000003700000000ULL, 0x0000370000000037ULL, 0x0000000000003700ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010100000101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010100000101ULL } }, // F
+		{ 0x3737000037370000ULL, { 0x0000000000000037ULL, 0x0000003700003700ULL, 0x0000370000000000ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010100000101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010100000101ULL } }, // F'
+		{ 0x3737000037370000ULL, { 0x0000370000003700ULL, 0x0000003700000037ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 24, 40,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // F2
+		{ 0x0000373700003737ULL, { 0x0037000000000000ULL, 0x3700000000370000ULL, 0x0000000037000000ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101000001010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101000001010000ULL } }, // B
+		{ 0x0000373700003737ULL, { 0x0000000000370000ULL, 0x0037000037000000ULL, 0x3700000000000000ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101000001010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101000001010000ULL } }, // B'
+		{ 0x0000373700003737ULL, { 0x3700000037000000ULL, 0x0037000000370000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 24, 40,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // B2
+		{ 0x0037370000373700ULL, { 0x0000000000000037ULL, 0x0000003737000000ULL, 0x3700000000000000ULL, 0x0000000000000000ULL }, { 24, 32, 40,  0 }, { 0x0000000000000000ULL, 0x0100000101000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100000101000001ULL, 0x0000000000000000ULL } }, // R
+		{ 0x0037370000373700ULL, { 0x0000003700000000ULL, 0x3700000000000037ULL, 0x0000000037000000ULL, 0x0000000000000000ULL }, { 24, 32, 40,  0 }, { 0x0000000000000000ULL, 0x0100000101000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100000101000001ULL, 0x0000000000000000ULL } }, // R'
+		{ 0x0037370000373700ULL, { 0x3700000037000000ULL, 0x0000003700000037ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  8, 56,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }, // R2
+		{ 0x3700003737000037ULL, { 0x0000370000000000ULL, 0x0037000000003700ULL, 0x0000000000370000ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0001010000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000010100ULL, 0x0000000000000000ULL } }, // L
+		{ 0x3700003737000037ULL, { 0x0000000000003700ULL, 0x0000370000370000ULL, 0x0037000000000000ULL, 0x0000000000000000ULL }, {  8, 32, 56,  0 }, { 0x0000000000000000ULL, 0x0001010000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000010100ULL, 0x0000000000000000ULL } }, // L'
+		{ 0x3700003737000037ULL, { 0x0037000000370000ULL, 0x0000370000003700ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 24, 40,  0,  0 }, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL } }  // L2
+	};
 
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFR(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFL(CORNER_DIR_FB);
-	
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBL(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_UBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBR(CORNER_DIR_FB);
-	}
-	
-	void c_Corners::c_D() // D
-	{
-		S64 buffer = GetStatus_DFR();
-		PutStatus_DFR(GetStatus_DFL());
-		PutStatus_DFL(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_DBR());
-		PutStatus_DBR(buffer);
+#ifdef GRCUBE3_SIMD_TURNS
+	// Face turns as bytes shuffles of the corners, from Stp::NONE to Stp::L2
+	constexpr c_Corners::CornersShuffle c_Corners::c_Shuffles[19] =
+	{ //     Shuffle (source position)                                        Layer                                                                                             Twist (out of the layer, in the layer)
+		{ {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // NONE
+		{ {  3,  0,  1,  2,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U
+		{ {  1,  2,  3,  0,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U'
+		{ {  2,  3,  0,  1,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U2
+		{ {  0,  1,  2,  3,  5,  6,  7,  4,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D
+		{ {  0,  1,  2,  3,  7,  4,  5,  6,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D'
+		{ {  0,  1,  2,  3,  6,  7,  4,  5,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D2
+		{ {  1,  5,  2,  3,  0,  4,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F
+		{ {  4,  0,  2,  3,  5,  1,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F'
+		{ {  5,  4,  2,  3,  1,  0,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F2
+		{ {  0,  1,  3,  7,  4,  5,  2,  6,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B
+		{ {  0,  1,  6,  2,  4,  5,  7,  3,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B'
+		{ {  0,  1,  7,  6,  4,  5,  3,  2,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B2
+		{ {  4,  1,  2,  0,  7,  5,  6,  3,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R
+		{ {  3,  1,  2,  7,  0,  5,  6,  4,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R'
+		{ {  7,  1,  2,  4,  3,  5,  6,  0,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R2
+		{ {  0,  2,  6,  3,  4,  1,  5,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // L
+		{ {  0,  5,  1,  3,  4,  6,  2,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // L'
+		{ {  0,  6,  5,  3,  4,  2,  1,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }  // L2
+	};
 
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFR(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFL(CORNER_DIR_FB);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBL(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBR(CORNER_DIR_FB);
-	}
-	
-	void c_Corners::c_D2() // D2
+	// Layer turns: the face turns followed by the slice turns. The two face turns of a slice turn move disjoint corners
+	// and twist them in the same way (opposite faces), so only the shuffles and the layers need to be merged
+	template <typename T> static constexpr FixedTable<T, LAYER_TURNS> LayerShuffles(const T (&Faces)[19])
 	{
-		S64 buffer = GetStatus_DFR();
-		PutStatus_DFR(GetStatus_DBL());
-		PutStatus_DBL(buffer);
-	
-		buffer = GetStatus_DFL();
-		PutStatus_DFL(GetStatus_DBR());
-		PutStatus_DBR(buffer);
+		FixedTable<T, LAYER_TURNS> Turns{};
+		for (uint t = 0u; t < SLICE_TURNS_FIRST; t++) Turns[t] = Faces[t];
+		for (uint t = 0u; t < LAYER_TURNS - SLICE_TURNS_FIRST; t++)
+		{
+			const T& F1 = Faces[static_cast<int>(stp_SliceTurns[t][0])];
+			const T& F2 = Faces[static_cast<int>(stp_SliceTurns[t][1])];
+			T& Slice = Turns[SLICE_TURNS_FIRST + t];
+			for (uint b = 0u; b < 16u; b++)
+			{
+				Slice.Shuffle[b] = F1.Shuffle[b] != b ? F1.Shuffle[b] : F2.Shuffle[b];
+				Slice.Layer[b] = F1.Layer[b] | F2.Layer[b];
+				Slice.Twist[b] = F1.Twist[b];
+			}
+		}
+		return Turns;
 	}
-	
-	void c_Corners::c_Dp() // D'
-	{
-		S64 buffer = GetStatus_DFR();
-		PutStatus_DFR(GetStatus_DBR());
-		PutStatus_DBR(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_DFL());
-		PutStatus_DFL(buffer);
 
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFR(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFL(CORNER_DIR_FB);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBL(CORNER_DIR_FB);
-		
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_FB) PutStatusDir_DBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBR(CORNER_DIR_FB);
-	}
-	
-	void c_Corners::c_F() // F
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_UFL());
-		PutStatus_UFL(GetStatus_DFL());
-		PutStatus_DFL(GetStatus_DFR());
-		PutStatus_DFR(buffer);
-	
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFR(CORNER_DIR_UD);	
-	}
-	
-	void c_Corners::c_F2() // F2
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_DFL());
-		PutStatus_DFL(buffer);
-	
-		buffer = GetStatus_UFL();
-		PutStatus_UFL(GetStatus_DFR());
-		PutStatus_DFR(buffer);
-	}
-	
-	void c_Corners::c_Fp() // F'
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_DFR());
-		PutStatus_DFR(GetStatus_DFL());
-		PutStatus_DFL(GetStatus_UFL());
-		PutStatus_UFL(buffer);
-	
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UFL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DFR(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_B() // B
-	{
-		S64 buffer = GetStatus_UBR();
-		PutStatus_UBR(GetStatus_DBR());
-		PutStatus_DBR(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_UBL());
-		PutStatus_UBL(buffer);
-		
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBR(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_B2() // B2
-	{
-		S64 buffer = GetStatus_UBL();
-		PutStatus_UBL(GetStatus_DBR());
-		PutStatus_DBR(buffer);
-	
-		buffer = GetStatus_UBR();
-		PutStatus_UBR(GetStatus_DBL());
-		PutStatus_DBL(buffer);
-	}
-	
-	void c_Corners::c_Bp() // B'
-	{
-		S64 buffer = GetStatus_UBR();
-		PutStatus_UBR(GetStatus_UBL());
-		PutStatus_UBL(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_DBR());
-		PutStatus_DBR(buffer);
-	
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_UBL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBL(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBR(CORNER_DIR_RL);
-		else if (buffer == CORNER_DIR_RL) PutStatusDir_DBR(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_R() // R
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_DFR());
-		PutStatus_DFR(GetStatus_DBR());
-		PutStatus_DBR(GetStatus_UBR());
-		PutStatus_UBR(buffer);
-	
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UFR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DFR(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DBR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UBR(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_R2() // R2
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_DBR());
-		PutStatus_DBR(buffer);
-	
-		buffer = GetStatus_UBR();
-		PutStatus_UBR(GetStatus_DFR());
-		PutStatus_DFR(buffer);
-	}
-	
-	void c_Corners::c_Rp() // R'
-	{
-		S64 buffer = GetStatus_UFR();
-		PutStatus_UFR(GetStatus_UBR());
-		PutStatus_UBR(GetStatus_DBR());
-		PutStatus_DBR(GetStatus_DFR());
-		PutStatus_DFR(buffer);
-	
-		buffer = GetStatusDir_UFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UFR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DFR(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DBR(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBR();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBR(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UBR(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_L() // L
-	{
-		S64 buffer = GetStatus_UFL();
-		PutStatus_UFL(GetStatus_UBL());
-		PutStatus_UBL(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_DFL());
-		PutStatus_DFL(buffer);
-	
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UFL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UBL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DBL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DFL(CORNER_DIR_UD);
-	}
-	
-	void c_Corners::c_L2() // L2
-	{
-		S64 buffer = GetStatus_UFL();
-		PutStatus_UFL(GetStatus_DBL());
-		PutStatus_DBL(buffer);
-	
-		buffer = GetStatus_UBL();
-		PutStatus_UBL(GetStatus_DFL());
-		PutStatus_DFL(buffer);
-	}
-	
-	void c_Corners::c_Lp() // L'
-	{
-		S64 buffer = GetStatus_UFL();
-		PutStatus_UFL(GetStatus_DFL());
-		PutStatus_DFL(GetStatus_DBL());
-		PutStatus_DBL(GetStatus_UBL());
-		PutStatus_UBL(buffer);
-	
-		buffer = GetStatusDir_UFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UFL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UFL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_UBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_UBL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_UBL(CORNER_DIR_UD);
-	
-		buffer = GetStatusDir_DBL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DBL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DBL(CORNER_DIR_UD);
-		
-		buffer = GetStatusDir_DFL();
-		if (buffer == CORNER_DIR_UD) PutStatusDir_DFL(CORNER_DIR_FB);
-		else if (buffer == CORNER_DIR_FB) PutStatusDir_DFL(CORNER_DIR_UD);
-	}
+	constexpr FixedTable<c_Corners::CornersShuffle, LAYER_TURNS> c_Corners::c_LayerShuffles = LayerShuffles(c_Shuffles);
+#endif
 
 	// Get mask for check if given corner is in solve condition
 	S64 c_Corners::GetMaskSolvedCorner(const Cnp c)
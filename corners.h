@@ -62,6 +62,16 @@ namespace grcube3
         // Check if corners coded in given mask are solved (default = all corners)
 		bool IsSolvedCorners(const S64 CMask = CMASK_DATA) const { return (corners & CMask) == (CMASK_SOLVED & CMask); }
 
+		// Check if corners in the positions coded in given mask (direction bits) have UD orientation for the given spin
+		// The direction is UD if the corner and the position are in the same tetrad (UFR-UBL-DFL-DBR or UFL-UBR-DFR-DBL)
+		// and the direction given by the spin if not
+		bool IsOrientedCorners(const S64 CMask, const Spn sp) const
+		{
+			const CornersOrientation& CO = c_Orientation[static_cast<int>(sp)];
+			const S64 Tetrads = (corners ^ (corners >> 2) ^ CMASK_SOLVED ^ (CMASK_SOLVED >> 2)) & CO.Mask; // Bit 8p set if different tetrads
+			return ((corners ^ (Tetrads << CO.Shift)) & CMask & CMASK_DIR_DATA) == 0ull;
+		}
+
 		// Check if a corner is solved
 		bool IsSolved_UFR() const { return GetCorner_UFR() == Cnr::UFR && GetCornerDir_UFR() == Cnd::UD; }
 		bool IsSolved_UFL() const { return GetCorner_UFL() == Cnr::UFL && GetCornerDir_UFL() == Cnd::UD; }
@@ -159,6 +169,9 @@ namespace grcube3
 		static constexpr auto CORNER_DIR_UD = 0x0000000000000000ULL;
 		static constexpr auto CORNER_DIR_FB = 0x0000000000000001ULL;
 		static constexpr auto CORNER_DIR_RL = 0x0000000000000002ULL;
+
+		// Lowest bit of each corner byte (direction bits shifted to the bottom of the byte)
+		static constexpr auto CMASK_DIR_LSB = 0x0101010101010101ULL;
 			
 		S64 corners; // Corners status
 
@@ -221,25 +234,86 @@ namespace grcube3
 		// Absolute corner positions from spin and corner positions
 		const static Acp acp_Positions[24][8];
 
-		// Corner positions from spin and absolut corner positions
-		const static Cnp cnp_Absolut[24][8];
+		// Corner positions from spin and absolut corner positions (inverse of acp_Positions)
+		const static FixedTable2<Cnp, 24, 8> cnp_Absolut;
+
+		// Corners directions for UD orientation (the orientation tables are generated from the spin and the corners tetrads)
+		const static FixedTable3<Cnd, 24, 8, 8> cnd_OrientationUD;
+
+		// UD orientation for a spin as bits operations: corners out of their tetrad have the direction given by the spin
+		struct CornersOrientation
+		{
+			S64 Mask; // Bit 0 of each corner position data if the direction is not UD for corners out of their tetrad
+			uint Shift; // Shift for the direction bit (4 for FB, 5 for RL)
+		};
 
-		// Corners directions for UD orientation
-		const static Cnd cnd_OrientationUD[24][8][8];
+		// UD orientation for each spin
+		const static CornersOrientation c_Orientation[24];
 
 		// Corners directions for FB orientation
-		const static Cnd cnd_OrientationFB[24][8][8];
+		const static FixedTable3<Cnd, 24, 8, 8> cnd_OrientationFB;
 
 		// Corners directions for RL orientation
-		const static Cnd cnd_OrientationRL[24][8][8];
+		const static FixedTable3<Cnd, 24, 8, 8> cnd_OrientationRL;
 		
-		// Movements
-		void c_U();	void c_U2(); void c_Up();
-		void c_D();	void c_D2(); void c_Dp();
-		void c_F();	void c_F2(); void c_Fp();
-		void c_B();	void c_B2(); void c_Bp();
-		void c_R();	void c_R2(); void c_Rp();
-		void c_L();	void c_L2(); void c_Lp();
+		// Face turn coded as a bits permutation of the corners status
+		// Each corner direction bit (b0, b1) is toggled with a xor of masked direction bits and a constant
+		struct CornersTurn
+		{
+			S64 Keep; // Bits not moved by the turn
+			S64 Masks[4]; // Groups of bits moved by the same rotation
+			uint Rotations[4]; // Left rotation for each group of bits
+			S64 Twist[6]; // b0 from b0, b0 from b1, b1 from b0, b1 from b1, b0 toggle, b1 toggle
+		};
+
+		// Face turns from Stp::NONE to Stp::L2
+		const static CornersTurn c_Turns[19];
+
+#ifdef GRCUBE3_SIMD_TURNS
+		// Face turn as a bytes shuffle of the corners status, the directions are twisted with a second shuffle used as lookup table
+		struct CornersShuffle
+		{
+			alignas(16) uint8_t Shuffle[16]; // Source corner position for each corner position
+			alignas(16) uint8_t Layer[16]; // Corner positions in the turned layer (second half of the twist table)
+			alignas(16) uint8_t Twist[16]; // Directions (bits 4-5) for the corners out and in the turned layer
+		};
+
+		// Face turns from Stp::NONE to Stp::L2
+		const static CornersShuffle c_Shuffles[19];
+
+		// Layer turns (see LAYER_TURNS): the face turns followed by the slice turns, merged from their two face turns
+		const static FixedTable<CornersShuffle, LAYER_TURNS> c_LayerShuffles;
+
+		// Movements (layer turn index, see LAYER_TURNS)
+		void c_Turn(const uint L)
+		{
+			const CornersShuffle& T = c_LayerShuffles[L];
+			const __m128i Bytes = _mm_shuffle_epi8(_mm_cvtsi64_si128(static_cast<long long>(corners)), _mm_load_si128(reinterpret_cast<const __m128i*>(T.Shuffle)));
+			const __m128i Dirs = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(Bytes, 4), _mm_set1_epi8(0x03)), _mm_load_si128(reinterpret_cast<const __m128i*>(T.Layer)));
+			const __m128i Twisted = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(T.Twist)), Dirs);
+			corners = static_cast<S64>(_mm_cvtsi128_si64(_mm_or_si128(_mm_and_si128(Bytes, _mm_set1_epi8(0x07)), Twisted)));
+		}
+#else
+		// Face turn (only Stp::NONE to Stp::L2 steps)
+		void c_Turn(const CornersTurn& T)
+		{
+			S64 c = corners & T.Keep;
+			for (int n = 0; n < 4; n++) c |= RotateLeft(corners & T.Masks[n], T.Rotations[n]);
+			const S64 b0 = (c >> 4) & CMASK_DIR_LSB, b1 = (c >> 5) & CMASK_DIR_LSB;
+			const S64 t0 = (b0 & T.Twist[0]) ^ (b1 & T.Twist[1]) ^ T.Twist[4];
+			const S64 t1 = (b0 & T.Twist[2]) ^ (b1 & T.Twist[3]) ^ T.Twist[5];
+			corners = c ^ (t0 << 4) ^ (t1 << 5);
+		}
+
+		// Movements (layer turn index, see LAYER_TURNS), the slice turns as their two face turns like the edges
+		void c_Turn(const uint L)
+		{
+			if (L < SLICE_TURNS_FIRST) { c_Turn(c_Turns[L]); return; }
+			const Stp* Faces = stp_SliceTurns[L - SLICE_TURNS_FIRST];
+			c_Turn(c_Turns[static_cast<int>(Faces[0])]);
+			c_Turn(c_Turns[static_cast<int>(Faces[1])]);
+		}
+#endif
 
 		void c_Reset() { corners = CMASK_SOLVED; } // Reset corners status
 		
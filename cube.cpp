@@ -28,7 +28,17 @@ namespace grcube3
 	
     // Arrays to follow spins when a cube has a turn
 
-    const Spn Cube::spn_Turns_x[24] =
+    constexpr Spn Cube::spn_Turns_NONE[24] =
+    {
+        Spn::UF, Spn::UR, Spn::UB, Spn::UL,
+        Spn::DF, Spn::DR, Spn::DB, Spn::DL,
+        Spn::FU, Spn::FR, Spn::FD, Spn::FL,
+        Spn::BU, Spn::BR, Spn::BD, Spn::BL,
+        Spn::RU, Spn::RF, Spn::RD, Spn::RB,
+        Spn::LU, Spn::LF, Spn::LD, Spn::LB
+    };
+
+    constexpr Spn Cube::spn_Turns_x[24] =
     {
         Spn::FD ,Spn::RD, Spn::BD, Spn::LD,
         Spn::FU, Spn::RU, Spn::BU, Spn::LU,
@@ -38,27 +48,7 @@ namespace grcube3
         Spn::UR, Spn::FR, Spn::DR, Spn::BR
     };
 
-    const Spn Cube::spn_Turns_xp[24] =
-    {
-        Spn::BU, Spn::LU, Spn::FU, Spn::RU,
-        Spn::BD, Spn::LD, Spn::FD, Spn::RD,
-        Spn::DF, Spn::LF, Spn::UF, Spn::RF,
-        Spn::DB, Spn::LB, Spn::UB, Spn::RB,
-        Spn::DR, Spn::BR, Spn::UR, Spn::FR,
-        Spn::DL, Spn::BL, Spn::UL, Spn::FL
-    };
-
-    const Spn Cube::spn_Turns_x2[24] =
-    {
-        Spn::DB, Spn::DL, Spn::DF, Spn::DR,
-        Spn::UB, Spn::UL, Spn::UF, Spn::UR,
-        Spn::BD, Spn::BL, Spn::BU, Spn::BR,
-        Spn::FD, Spn::FL, Spn::FU, Spn::FR,
-        Spn::LD, Spn::LB, Spn::LU, Spn::LF,
-        Spn::RD, Spn::RB, Spn::RU, Spn::RF
-    };
-
-    const Spn Cube::spn_Turns_y[24] =
+    constexpr Spn Cube::spn_Turns_y[24] =
     {
         Spn::UR, Spn::UB, Spn::UL, Spn::UF,
         Spn::DL, Spn::DF, Spn::DR, Spn::DB,
@@ -68,27 +58,7 @@ namespace grcube3
         Spn::LB, Spn::LU, Spn::LF, Spn::LD
     };
 
-    const Spn Cube::spn_Turns_yp[24] =
-    {
-        Spn::UL, Spn::UF, Spn::UR, Spn::UB,
-        Spn::DR, Spn::DB, Spn::DL, Spn::DF,
-        Spn::FR, Spn::FD, Spn::FL, Spn::FU,
-        Spn::BL, Spn::BU, Spn::BR, Spn::BD,
-        Spn::RB, Spn::RU, Spn::RF, Spn::RD,
-        Spn::LF, Spn::LD, Spn::LB, Spn::LU
-    };
-
-    const Spn Cube::spn_Turns_y2[24] =
-    {
-        Spn::UB, Spn::UL, Spn::UF, Spn::UR,
-        Spn::DB, Spn::DL, Spn::DF, Spn::DR,
-        Spn::FD, Spn::FL, Spn::FU, Spn::FR,
-        Spn::BD, Spn::BL, Spn::BU, Spn::BR,
-        Spn::RD, Spn::RB, Spn::RU, Spn::RF,
-        Spn::LD, Spn::LB, Spn::LU, Spn::LF,
-    };
-
-    const Spn Cube::spn_Turns_z[24] =
+    constexpr Spn Cube::spn_Turns_z[24] =
     {
         Spn::LF, Spn::FR, Spn::RB, Spn::BL,
         Spn::RF, Spn::BR, Spn::LB, Spn::FL,
@@ -98,25 +68,25 @@ namespace grcube3
         Spn::FU, Spn::DF, Spn::BD, Spn::UB
     };
 
-    const Spn Cube::spn_Turns_zp[24] =
+    // Spins after a cube turn repeated the given times
+    static constexpr FixedTable<Spn, 24> RepeatSpinTurn(const Spn (&Turn)[24], const uint Times)
     {
-        Spn::RF, Spn::BR, Spn::LB, Spn::FL,
-        Spn::LF, Spn::FR, Spn::RB, Spn::BL,
-        Spn::LU, Spn::UR, Spn::RD, Spn::DL,
-        Spn::RU, Spn::DR, Spn::LD, Spn::UL,
-        Spn::FU, Spn::DF, Spn::BD, Spn::UB,
-        Spn::BU, Spn::UF, Spn::FD, Spn::DB
-    };
+        FixedTable<Spn, 24> Spins{};
+        for (uint sp = 0u; sp < 24u; sp++)
+        {
+            Spn S = static_cast<Spn>(sp);
+            for (uint t = 0u; t < Times; t++) S = Turn[static_cast<int>(S)];
+            Spins[sp] = S;
+        }
+        return Spins;
+    }
 
-    const Spn Cube::spn_Turns_z2[24] =
-    {
-        Spn::DF, Spn::DR, Spn::DB, Spn::DL,
-        Spn::UF, Spn::UR, Spn::UB, Spn::UL,
-        Spn::BU, Spn::BR, Spn::BD, Spn::BL,
-        Spn::FU, Spn::FR, Spn::FD, Spn::FL,
-        Spn::LU, Spn::LF, Spn::LD, Spn::LB,
-        Spn::RU, Spn::RF, Spn::RD, Spn::RB
-    };
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_x2 = RepeatSpinTurn(spn_Turns_x, 2u);
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_xp = RepeatSpinTurn(spn_Turns_x, 3u);
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_y2 = RepeatSpinTurn(spn_Turns_y, 2u);
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_yp = RepeatSpinTurn(spn_Turns_y, 3u);
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_z2 = RepeatSpinTurn(spn_Turns_z, 2u);
+    constexpr FixedTable<Spn, 24> Cube::spn_Turns_zp = RepeatSpinTurn(spn_Turns_z, 3u);
 
     // Two turns array for get a final spin from an inital spin [Start spin][Final spin][Turns to pass from start to final spin]
     const Stp Cube::stp_Turns[24][24][2] =
@@ -206,7 +176,7 @@ namespace grcube3
     };
 
     // Array with spins string representation
-    const std::string Cube::string_Spins[24] =
+    const char Cube::string_Spins[24][3] =
     {
         "UF", "UR", "UB", "UL",
         "DF", "DR", "DB", "DL",
@@ -217,7 +187,7 @@ namespace grcube3
     };
 
     // Array with pieces string representation
-    const std::string Cube::string_Pieces[26] =
+    const char Cube::string_Pieces[26][4] =
     {
         "U", "D", "F", "B", "R", "L",
 		"FR", "FL", "BL", "BR", "UF", "UL", "UB", "UR", "DF", "DL", "DB", "DR",
@@ -225,7 +195,7 @@ namespace grcube3
     };
 
     // Array with stickers string representation
-    const std::string Cube::string_Stickers[54] =
+    const char Cube::string_Stickers[54][6] =
     {
         "U", "D", "F", "B", "R", "L",
 		"FR_F", "FR_R", "FL_F", "FL_L", "BL_B", "BL_L", "BR_B", "BR_R",
@@ -243,7 +213,7 @@ namespace grcube3
 	// 'U/D' layer edge in layer 'U/D': -EDGE_POS- if U/D sticker is in UD direction / -EDGE_NEG- if U/D sticker is in FB/RL directions
 	// Directions for corners:
 	// U/D sticker direction: UD -> CORNER_UD / FB -> CORNER_FB / RL -> CORNER_RL
-	const std::string Cube::string_Directions[6] =
+	const char Cube::string_Directions[6][5] =
 	{
 		"NONE", // Centers don't need direction
 		"POS", "NEG", // Edg direction (positive / negative)
@@ -279,37 +249,8 @@ namespace grcube3
         { Lyr::NONE, Lyr::L, Lyr::R, Lyr::B, Lyr::F, Lyr::D, Lyr::U, Lyr::M, Lyr::S, Lyr::E }  // LB
     };
 
-    // Piece positions from spin and absolut piece positions
-    const Pcp Cube::pcp_Absolut[24][26] =
-    {
-        { Pcp::U, Pcp::D, Pcp::F, Pcp::B, Pcp::R, Pcp::L, Pcp::FR, Pcp::FL, Pcp::BL, Pcp::BR, Pcp::UF, Pcp::UL, Pcp::UB, Pcp::UR, Pcp::DF, Pcp::DL, Pcp::DB, Pcp::DR, Pcp::UFR, Pcp::UFL, Pcp::UBL, Pcp::UBR, Pcp::DFR, Pcp::DFL, Pcp::DBL, Pcp::DBR }, // UF
-        { Pcp::U, Pcp::D, Pcp::R, Pcp::L, Pcp::B, Pcp::F, Pcp::BR, Pcp::FR, Pcp::FL, Pcp::BL, Pcp::UR, Pcp::UF, Pcp::UL, Pcp::UB, Pcp::DR, Pcp::DF, Pcp::DL, Pcp::DB, Pcp::UBR, Pcp::UFR, Pcp::UFL, Pcp::UBL, Pcp::DBR, Pcp::DFR, Pcp::DFL, Pcp::DBL }, // UR
-        { Pcp::U, Pcp::D, Pcp::B, Pcp::F, Pcp::L, Pcp::R, Pcp::BL, Pcp::BR, Pcp::FR, Pcp::FL, Pcp::UB, Pcp::UR, Pcp::UF, Pcp::UL, Pcp::DB, Pcp::DR, Pcp::DF, Pcp::DL, Pcp::UBL, Pcp::UBR, Pcp::UFR, Pcp::UFL, Pcp::DBL, Pcp::DBR, Pcp::DFR, Pcp::DFL }, // UB
-        { Pcp::U, Pcp::D, Pcp::L, Pcp::R, Pcp::F, Pcp::B, Pcp::FL, Pcp::BL, Pcp::BR, Pcp::FR, Pcp::UL, Pcp::UB, Pcp::UR, Pcp::UF, Pcp::DL, Pcp::DB, Pcp::DR, Pcp::DF, Pcp::UFL, Pcp::UBL, Pcp::UBR, Pcp::UFR, Pcp::DFL, Pcp::DBL, Pcp::DBR, Pcp::DFR }, // UL
-        { Pcp::D, Pcp::U, Pcp::F, Pcp::B, Pcp::L, Pcp::R, Pcp::FL, Pcp::FR, Pcp::BR, Pcp::BL, Pcp::DF, Pcp::DR, Pcp::DB, Pcp::DL, Pcp::UF, Pcp::UR, Pcp::UB, Pcp::UL, Pcp::DFL, Pcp::DFR, Pcp::DBR, Pcp::DBL, Pcp::UFL, Pcp::UFR, Pcp::UBR, Pcp::UBL }, // DF
-        { Pcp::D, Pcp::U, Pcp::R, Pcp::L, Pcp::F, Pcp::B, Pcp::FR, Pcp::BR, Pcp::BL, Pcp::FL, Pcp::DR, Pcp::DB, Pcp::DL, Pcp::DF, Pcp::UR, Pcp::UB, Pcp::UL, Pcp::UF, Pcp::DFR, Pcp::DBR, Pcp::DBL, Pcp::DFL, Pcp::UFR, Pcp::UBR, Pcp::UBL, Pcp::UFL }, // DR
-        { Pcp::D, Pcp::U, Pcp::B, Pcp::F, Pcp::R, Pcp::L, Pcp::BR, Pcp::BL, Pcp::FL, Pcp::FR, Pcp::DB, Pcp::DL, Pcp::DF, Pcp::DR, Pcp::UB, Pcp::UL, Pcp::UF, Pcp::UR, Pcp::DBR, Pcp::DBL, Pcp::DFL, Pcp::DFR, Pcp::UBR, Pcp::UBL, Pcp::UFL, Pcp::UFR }, // DB
-        { Pcp::D, Pcp::U, Pcp::L, Pcp::R, Pcp::B, Pcp::F, Pcp::BL, Pcp::FL, Pcp::FR, Pcp::BR, Pcp::DL, Pcp::DF, Pcp::DR, Pcp::DB, Pcp::UL, Pcp::UF, Pcp::UR, Pcp::UB, Pcp::DBL, Pcp::DFL, Pcp::DFR, Pcp::DBR, Pcp::UBL, Pcp::UFL, Pcp::UFR, Pcp::UBR }, // DL
-        { Pcp::F, Pcp::B, Pcp::U, Pcp::D, Pcp::L, Pcp::R, Pcp::UL, Pcp::UR, Pcp::DR, Pcp::DL, Pcp::UF, Pcp::FR, Pcp::DF, Pcp::FL, Pcp::UB, Pcp::BR, Pcp::DB, Pcp::BL, Pcp::UFL, Pcp::UFR, Pcp::DFR, Pcp::DFL, Pcp::UBL, Pcp::UBR, Pcp::DBR, Pcp::DBL }, // FU
-        { Pcp::F, Pcp::B, Pcp::R, Pcp::L, Pcp::U, Pcp::D, Pcp::UR, Pcp::DR, Pcp::DL, Pcp::UL, Pcp::FR, Pcp::DF, Pcp::FL, Pcp::UF, Pcp::BR, Pcp::DB, Pcp::BL, Pcp::UB, Pcp::UFR, Pcp::DFR, Pcp::DFL, Pcp::UFL, Pcp::UBR, Pcp::DBR, Pcp::DBL, Pcp::UBL }, // FR
-        { Pcp::F, Pcp::B, Pcp::D, Pcp::U, Pcp::R, Pcp::L, Pcp::DR, Pcp::DL, Pcp::UL, Pcp::UR, Pcp::DF, Pcp::FL, Pcp::UF, Pcp::FR, Pcp::DB, Pcp::BL, Pcp::UB, Pcp::BR, Pcp::DFR, Pcp::DFL, Pcp::UFL, Pcp::UFR, Pcp::DBR, Pcp::DBL, Pcp::UBL, Pcp::UBR }, // FD
-        { Pcp::F, Pcp::B, Pcp::L, Pcp::R, Pcp::D, Pcp::U, Pcp::DL, Pcp::UL, Pcp::UR, Pcp::DR, Pcp::FL, Pcp::UF, Pcp::FR, Pcp::DF, Pcp::BL, Pcp::UB, Pcp::BR, Pcp::DB, Pcp::DFL, Pcp::UFL, Pcp::UFR, Pcp::DFR, Pcp::DBL, Pcp::UBL, Pcp::UBR, Pcp::DBR }, // FL
-        { Pcp::B, Pcp::F, Pcp::U, Pcp::D, Pcp::R, Pcp::L, Pcp::UR, Pcp::UL, Pcp::DL, Pcp::DR, Pcp::UB, Pcp::BL, Pcp::DB, Pcp::BR, Pcp::UF, Pcp::FL, Pcp::DF, Pcp::FR, Pcp::UBR, Pcp::UBL, Pcp::DBL, Pcp::DBR, Pcp::UFR, Pcp::UFL, Pcp::DFL, Pcp::DFR }, // BU
-        { Pcp::B, Pcp::F, Pcp::R, Pcp::L, Pcp::D, Pcp::U, Pcp::DR, Pcp::UR, Pcp::UL, Pcp::DL, Pcp::BR, Pcp::UB, Pcp::BL, Pcp::DB, Pcp::FR, Pcp::UF, Pcp::FL, Pcp::DF, Pcp::DBR, Pcp::UBR, Pcp::UBL, Pcp::DBL, Pcp::DFR, Pcp::UFR, Pcp::UFL, Pcp::DFL }, // BR
-        { Pcp::B, Pcp::F, Pcp::D, Pcp::U, Pcp::L, Pcp::R, Pcp::DL, Pcp::DR, Pcp::UR, Pcp::UL, Pcp::DB, Pcp::BR, Pcp::UB, Pcp::BL, Pcp::DF, Pcp::FR, Pcp::UF, Pcp::FL, Pcp::DBL, Pcp::DBR, Pcp::UBR, Pcp::UBL, Pcp::DFL, Pcp::DFR, Pcp::UFR, Pcp::UFL }, // BD
-        { Pcp::B, Pcp::F, Pcp::L, Pcp::R, Pcp::U, Pcp::D, Pcp::UL, Pcp::DL, Pcp::DR, Pcp::UR, Pcp::BL, Pcp::DB, Pcp::BR, Pcp::UB, Pcp::FL, Pcp::DF, Pcp::FR, Pcp::UF, Pcp::UBL, Pcp::DBL, Pcp::DBR, Pcp::UBR, Pcp::UFL, Pcp::DFL, Pcp::DFR, Pcp::UFR }, // BL
-        { Pcp::R, Pcp::L, Pcp::U, Pcp::D, Pcp::F, Pcp::B, Pcp::UF, Pcp::UB, Pcp::DB, Pcp::DF, Pcp::UR, Pcp::BR, Pcp::DR, Pcp::FR, Pcp::UL, Pcp::BL, Pcp::DL, Pcp::FL, Pcp::UFR, Pcp::UBR, Pcp::DBR, Pcp::DFR, Pcp::UFL, Pcp::UBL, Pcp::DBL, Pcp::DFL }, // RU
-        { Pcp::R, Pcp::L, Pcp::F, Pcp::B, Pcp::D, Pcp::U, Pcp::DF, Pcp::UF, Pcp::UB, Pcp::DB, Pcp::FR, Pcp::UR, Pcp::BR, Pcp::DR, Pcp::FL, Pcp::UL, Pcp::BL, Pcp::DL, Pcp::DFR, Pcp::UFR, Pcp::UBR, Pcp::DBR, Pcp::DFL, Pcp::UFL, Pcp::UBL, Pcp::DBL }, // RF
-        { Pcp::R, Pcp::L, Pcp::D, Pcp::U, Pcp::B, Pcp::F, Pcp::DB, Pcp::DF, Pcp::UF, Pcp::UB, Pcp::DR, Pcp::FR, Pcp::UR, Pcp::BR, Pcp::DL, Pcp::FL, Pcp::UL, Pcp::BL, Pcp::DBR, Pcp::DFR, Pcp::UFR, Pcp::UBR, Pcp::DBL, Pcp::DFL, Pcp::UFL, Pcp::UBL }, // RD
-        { Pcp::R, Pcp::L, Pcp::B, Pcp::F, Pcp::U, Pcp::D, Pcp::UB, Pcp::DB, Pcp::DF, Pcp::UF, Pcp::BR, Pcp::DR, Pcp::FR, Pcp::UR, Pcp::BL, Pcp::DL, Pcp::FL, Pcp::UL, Pcp::UBR, Pcp::DBR, Pcp::DFR, Pcp::UFR, Pcp::UBL, Pcp::DBL, Pcp::DFL, Pcp::UFL }, // RB
-        { Pcp::L, Pcp::R, Pcp::U, Pcp::D, Pcp::B, Pcp::F, Pcp::UB, Pcp::UF, Pcp::DF, Pcp::DB, Pcp::UL, Pcp::FL, Pcp::DL, Pcp::BL, Pcp::UR, Pcp::FR, Pcp::DR, Pcp::BR, Pcp::UBL, Pcp::UFL, Pcp::DFL, Pcp::DBL, Pcp::UBR, Pcp::UFR, Pcp::DFR, Pcp::DBR }, // LU
-        { Pcp::L, Pcp::R, Pcp::F, Pcp::B, Pcp::U, Pcp::D, Pcp::UF, Pcp::DF, Pcp::DB, Pcp::UB, Pcp::FL, Pcp::DL, Pcp::BL, Pcp::UL, Pcp::FR, Pcp::DR, Pcp::BR, Pcp::UR, Pcp::UFL, Pcp::DFL, Pcp::DBL, Pcp::UBL, Pcp::UFR, Pcp::DFR, Pcp::DBR, Pcp::UBR }, // LF
-        { Pcp::L, Pcp::R, Pcp::D, Pcp::U, Pcp::F, Pcp::B, Pcp::DF, Pcp::DB, Pcp::UB, Pcp::UF, Pcp::DL, Pcp::BL, Pcp::UL, Pcp::FL, Pcp::DR, Pcp::BR, Pcp::UR, Pcp::FR, Pcp::DFL, Pcp::DBL, Pcp::UBL, Pcp::UFL, Pcp::DFR, Pcp::DBR, Pcp::UBR, Pcp::UFR }, // LD
-        { Pcp::L, Pcp::R, Pcp::B, Pcp::F, Pcp::D, Pcp::U, Pcp::DB, Pcp::UB, Pcp::UF, Pcp::DF, Pcp::BL, Pcp::UL, Pcp::FL, Pcp::DL, Pcp::BR, Pcp::UR, Pcp::FR, Pcp::DR, Pcp::DBL, Pcp::UBL, Pcp::UFL, Pcp::DFL, Pcp::DBR, Pcp::UBR, Pcp::UFR, Pcp::DFR }  // LB
-    };
-	
 	// Absolute piece positions from spin and piece positions
-	const App Cube::app_Positions[24][26] =
+	constexpr App Cube::app_Positions[24][26] =
 	{
 		{ App::U, App::D, App::F, App::B, App::R, App::L, App::FR, App::FL, App::BL, App::BR, App::UF, App::UL, App::UB, App::UR, App::DF, App::DL, App::DB, App::DR, App::UFR, App::UFL, App::UBL, App::UBR, App::DFR, App::DFL, App::DBL, App::DBR }, // UF
 		{ App::U, App::D, App::L, App::R, App::F, App::B, App::FL, App::BL, App::BR, App::FR, App::UL, App::UB, App::UR, App::UF, App::DL, App::DB, App::DR, App::DF, App::UFL, App::UBL, App::UBR, App::UFR, App::DFL, App::DBL, App::DBR, App::DFR }, // UR
@@ -337,37 +278,11 @@ namespace grcube3
 		{ App::L, App::R, App::B, App::F, App::D, App::U, App::DB, App::UB, App::UF, App::DF, App::BL, App::UL, App::FL, App::DL, App::BR, App::UR, App::FR, App::DR, App::DBL, App::UBL, App::UFL, App::DFL, App::DBR, App::UBR, App::UFR, App::DFR }  // LB
 	};	
 
-    // Sticker positions from spin and absolut sticker positions
-    const Sps Cube::sps_Absolut[24][54] =
-    {
-        { Sps::U, Sps::D, Sps::F, Sps::B, Sps::R, Sps::L, Sps::FR_F, Sps::FR_R, Sps::FL_F, Sps::FL_L, Sps::BL_B, Sps::BL_L, Sps::BR_B, Sps::BR_R, Sps::UF_U, Sps::UF_F, Sps::UL_U, Sps::UL_L, Sps::UB_U, Sps::UB_B, Sps::UR_U, Sps::UR_R, Sps::DF_D, Sps::DF_F, Sps::DL_D, Sps::DL_L, Sps::DB_D, Sps::DB_B, Sps::DR_D, Sps::DR_R, Sps::UFR_U, Sps::UFR_F, Sps::UFR_R, Sps::UFL_U, Sps::UFL_F, Sps::UFL_L, Sps::UBL_U, Sps::UBL_B, Sps::UBL_L, Sps::UBR_U, Sps::UBR_B, Sps::UBR_R, Sps::DFR_D, Sps::DFR_F, Sps::DFR_R, Sps::DFL_D, Sps::DFL_F, Sps::DFL_L, Sps::DBL_D, Sps::DBL_B, Sps::DBL_L, Sps::DBR_D, Sps::DBR_B, Sps::DBR_R }, // UF
-        { Sps::U, Sps::D, Sps::R, Sps::L, Sps::B, Sps::F, Sps::BR_R, Sps::BR_B, Sps::FR_R, Sps::FR_F, Sps::FL_L, Sps::FL_F, Sps::BL_L, Sps::BL_B, Sps::UR_U, Sps::UR_R, Sps::UF_U, Sps::UF_F, Sps::UL_U, Sps::UL_L, Sps::UB_U, Sps::UB_B, Sps::DR_D, Sps::DR_R, Sps::DF_D, Sps::DF_F, Sps::DL_D, Sps::DL_L, Sps::DB_D, Sps::DB_B, Sps::UBR_U, Sps::UBR_R, Sps::UBR_B, Sps::UFR_U, Sps::UFR_R, Sps::UFR_F, Sps::UFL_U, Sps::UFL_L, Sps::UFL_F, Sps::UBL_U, Sps::UBL_L, Sps::UBL_B, Sps::DBR_D, Sps::DBR_R, Sps::DBR_B, Sps::DFR_D, Sps::DFR_R, Sps::DFR_F, Sps::DFL_D, Sps::DFL_L, Sps::DFL_F, Sps::DBL_D, Sps::DBL_L, Sps::DBL_B }, // UR
-        { Sps::U, Sps::D, Sps::B, Sps::F, Sps::L, Sps::R, Sps::BL_B, Sps::BL_L, Sps::BR_B, Sps::BR_R, Sps::FR_F, Sps::FR_R, Sps::FL_F, Sps::FL_L, Sps::UB_U, Sps::UB_B, Sps::UR_U, Sps::UR_R, Sps::UF_U, Sps::UF_F, Sps::UL_U, Sps::UL_L, Sps::DB_D, Sps::DB_B, Sps::DR_D, Sps::DR_R, Sps::DF_D, Sps::DF_F, Sps::DL_D, Sps::DL_L, Sps::UBL_U, Sps::UBL_B, Sps::UBL_L, Sps::UBR_U, Sps::UBR_B, Sps::UBR_R, Sps::UFR_U, Sps::UFR_F, Sps::UFR_R, Sps::UFL_U, Sps::UFL_F, Sps::UFL_L, Sps::DBL_D, Sps::DBL_B, Sps::DBL_L, Sps::DBR_D, Sps::DBR_B, Sps::DBR_R, Sps::DFR_D, Sps::DFR_F, Sps::DFR_R, Sps::DFL_D, Sps::DFL_F, Sps::DFL_L }, // UB
-        { Sps::U, Sps::D, Sps::L, Sps::R, Sps::F, Sps::B, Sps::FL_L, Sps::FL_F, Sps::BL_L, Sps::BL_B, Sps::BR_R, Sps::BR_B, Sps::FR_R, Sps::FR_F, Sps::UL_U, Sps::UL_L, Sps::UB_U, Sps::UB_B, Sps::UR_U, Sps::UR_R, Sps::UF_U, Sps::UF_F, Sps::DL_D, Sps::DL_L, Sps::DB_D, Sps::DB_B, Sps::DR_D, Sps::DR_R, Sps::DF_D, Sps::DF_F, Sps::UFL_U, Sps::UFL_L, Sps::UFL_F, Sps::UBL_U, Sps::UBL_L, Sps::UBL_B, Sps::UBR_U, Sps::UBR_R, Sps::UBR_B, Sps::UFR_U, Sps::UFR_R, Sps::UFR_F, Sps::DFL_D, Sps::DFL_L, Sps::DFL_F, Sps::DBL_D, Sps::DBL_L, Sps::DBL_B, Sps::DBR_D, Sps::DBR_R, Sps::DBR_B, Sps::DFR_D, Sps::DFR_R, Sps::DFR_F }, // UL
-        { Sps::D, Sps::U, Sps::F, Sps::B, Sps::L, Sps::R, Sps::FL_F, Sps::FL_L, Sps::FR_F, Sps::FR_R, Sps::BR_B, Sps::BR_R, Sps::BL_B, Sps::BL_L, Sps::DF_D, Sps::DF_F, Sps::DR_D, Sps::DR_R, Sps::DB_D, Sps::DB_B, Sps::DL_D, Sps::DL_L, Sps::UF_U, Sps::UF_F, Sps::UR_U, Sps::UR_R, Sps::UB_U, Sps::UB_B, Sps::UL_U, Sps::UL_L, Sps::DFL_D, Sps::DFL_F, Sps::DFL_L, Sps::DFR_D, Sps::DFR_F, Sps::DFR_R, Sps::DBR_D, Sps::DBR_B, Sps::DBR_R, Sps::DBL_D, Sps::DBL_B, Sps::DBL_L, Sps::UFL_U, Sps::UFL_F, Sps::UFL_L, Sps::UFR_U, Sps::UFR_F, Sps::UFR_R, Sps::UBR_U, Sps::UBR_B, Sps::UBR_R, Sps::UBL_U, Sps::UBL_B, Sps::UBL_L }, // DF
-        { Sps::D, Sps::U, Sps::R, Sps::L, Sps::F, Sps::B, Sps::FR_R, Sps::FR_F, Sps::BR_R, Sps::BR_B, Sps::BL_L, Sps::BL_B, Sps::FL_L, Sps::FL_F, Sps::DR_D, Sps::DR_R, Sps::DB_D, Sps::DB_B, Sps::DL_D, Sps::DL_L, Sps::DF_D, Sps::DF_F, Sps::UR_U, Sps::UR_R, Sps::UB_U, Sps::UB_B, Sps::UL_U, Sps::UL_L, Sps::UF_U, Sps::UF_F, Sps::DFR_D, Sps::DFR_R, Sps::DFR_F, Sps::DBR_D, Sps::DBR_R, Sps::DBR_B, Sps::DBL_D, Sps::DBL_L, Sps::DBL_B, Sps::DFL_D, Sps::DFL_L, Sps::DFL_F, Sps::UFR_U, Sps::UFR_R, Sps::UFR_F, Sps::UBR_U, Sps::UBR_R, Sps::UBR_B, Sps::UBL_U, Sps::UBL_L, Sps::UBL_B, Sps::UFL_U, Sps::UFL_L, Sps::UFL_F }, // DR
-        { Sps::D, Sps::U, Sps::B, Sps::F, Sps::R, Sps::L, Sps::BR_B, Sps::BR_R, Sps::BL_B, Sps::BL_L, Sps::FL_F, Sps::FL_L, Sps::FR_F, Sps::FR_R, Sps::DB_D, Sps::DB_B, Sps::DL_D, Sps::DL_L, Sps::DF_D, Sps::DF_F, Sps::DR_D, Sps::DR_R, Sps::UB_U, Sps::UB_B, Sps::UL_U, Sps::UL_L, Sps::UF_U, Sps::UF_F, Sps::UR_U, Sps::UR_R, Sps::DBR_D, Sps::DBR_B, Sps::DBR_R, Sps::DBL_D, Sps::DBL_B, Sps::DBL_L, Sps::DFL_D, Sps::DFL_F, Sps::DFL_L, Sps::DFR_D, Sps::DFR_F, Sps::DFR_R, Sps::UBR_U, Sps::UBR_B, Sps::UBR_R, Sps::UBL_U, Sps::UBL_B, Sps::UBL_L, Sps::UFL_U, Sps::UFL_F, Sps::UFL_L, Sps::UFR_U, Sps::UFR_F, Sps::UFR_R }, // DB
-        { Sps::D, Sps::U, Sps::L, Sps::R, Sps::B, Sps::F, Sps::BL_L, Sps::BL_B, Sps::FL_L, Sps::FL_F, Sps::FR_R, Sps::FR_F, Sps::BR_R, Sps::BR_B, Sps::DL_D, Sps::DL_L, Sps::DF_D, Sps::DF_F, Sps::DR_D, Sps::DR_R, Sps::DB_D, Sps::DB_B, Sps::UL_U, Sps::UL_L, Sps::UF_U, Sps::UF_F, Sps::UR_U, Sps::UR_R, Sps::UB_U, Sps::UB_B, Sps::DBL_D, Sps::DBL_L, Sps::DBL_B, Sps::DFL_D, Sps::DFL_L, Sps::DFL_F, Sps::DFR_D, Sps::DFR_R, Sps::DFR_F, Sps::DBR_D, Sps::DBR_R, Sps::DBR_B, Sps::UBL_U, Sps::UBL_L, Sps::UBL_B, Sps::UFL_U, Sps::UFL_L, Sps::UFL_F, Sps::UFR_U, Sps::UFR_R, Sps::UFR_F, Sps::UBR_U, Sps::UBR_R, Sps::UBR_B }, // DL
-        { Sps::F, Sps::B, Sps::U, Sps::D, Sps::L, Sps::R, Sps::UL_U, Sps::UL_L, Sps::UR_U, Sps::UR_R, Sps::DR_D, Sps::DR_R, Sps::DL_D, Sps::DL_L, Sps::UF_F, Sps::UF_U, Sps::FR_F, Sps::FR_R, Sps::DF_F, Sps::DF_D, Sps::FL_F, Sps::FL_L, Sps::UB_B, Sps::UB_U, Sps::BR_B, Sps::BR_R, Sps::DB_B, Sps::DB_D, Sps::BL_B, Sps::BL_L, Sps::UFL_F, Sps::UFL_U, Sps::UFL_L, Sps::UFR_F, Sps::UFR_U, Sps::UFR_R, Sps::DFR_F, Sps::DFR_D, Sps::DFR_R, Sps::DFL_F, Sps::DFL_D, Sps::DFL_L, Sps::UBL_B, Sps::UBL_U, Sps::UBL_L, Sps::UBR_B, Sps::UBR_U, Sps::UBR_R, Sps::DBR_B, Sps::DBR_D, Sps::DBR_R, Sps::DBL_B, Sps::DBL_D, Sps::DBL_L }, // FU
-        { Sps::F, Sps::B, Sps::R, Sps::L, Sps::U, Sps::D, Sps::UR_R, Sps::UR_U, Sps::DR_R, Sps::DR_D, Sps::DL_L, Sps::DL_D, Sps::UL_L, Sps::UL_U, Sps::FR_F, Sps::FR_R, Sps::DF_F, Sps::DF_D, Sps::FL_F, Sps::FL_L, Sps::UF_F, Sps::UF_U, Sps::BR_B, Sps::BR_R, Sps::DB_B, Sps::DB_D, Sps::BL_B, Sps::BL_L, Sps::UB_B, Sps::UB_U, Sps::UFR_F, Sps::UFR_R, Sps::UFR_U, Sps::DFR_F, Sps::DFR_R, Sps::DFR_D, Sps::DFL_F, Sps::DFL_L, Sps::DFL_D, Sps::UFL_F, Sps::UFL_L, Sps::UFL_U, Sps::UBR_B, Sps::UBR_R, Sps::UBR_U, Sps::DBR_B, Sps::DBR_R, Sps::DBR_D, Sps::DBL_B, Sps::DBL_L, Sps::DBL_D, Sps::UBL_B, Sps::UBL_L, Sps::UBL_U }, // FR
-        { Sps::F, Sps::B, Sps::D, Sps::U, Sps::R, Sps::L, Sps::DR_D, Sps::DR_R, Sps::DL_D, Sps::DL_L, Sps::UL_U, Sps::UL_L, Sps::UR_U, Sps::UR_R, Sps::DF_F, Sps::DF_D, Sps::FL_F, Sps::FL_L, Sps::UF_F, Sps::UF_U, Sps::FR_F, Sps::FR_R, Sps::DB_B, Sps::DB_D, Sps::BL_B, Sps::BL_L, Sps::UB_B, Sps::UB_U, Sps::BR_B, Sps::BR_R, Sps::DFR_F, Sps::DFR_D, Sps::DFR_R, Sps::DFL_F, Sps::DFL_D, Sps::DFL_L, Sps::UFL_F, Sps::UFL_U, Sps::UFL_L, Sps::UFR_F, Sps::UFR_U, Sps::UFR_R, Sps::DBR_B, Sps::DBR_D, Sps::DBR_R, Sps::DBL_B, Sps::DBL_D, Sps::DBL_L, Sps::UBL_B, Sps::UBL_U, Sps::UBL_L, Sps::UBR_B, Sps::UBR_U, Sps::UBR_R }, // FD
-        { Sps::F, Sps::B, Sps::L, Sps::R, Sps::D, Sps::U, Sps::DL_L, Sps::DL_D, Sps::UL_L, Sps::UL_U, Sps::UR_R, Sps::UR_U, Sps::DR_R, Sps::DR_D, Sps::FL_F, Sps::FL_L, Sps::UF_F, Sps::UF_U, Sps::FR_F, Sps::FR_R, Sps::DF_F, Sps::DF_D, Sps::BL_B, Sps::BL_L, Sps::UB_B, Sps::UB_U, Sps::BR_B, Sps::BR_R, Sps::DB_B, Sps::DB_D, Sps::DFL_F, Sps::DFL_L, Sps::DFL_D, Sps::UFL_F, Sps::UFL_L, Sps::UFL_U, Sps::UFR_F, Sps::UFR_R, Sps::UFR_U, Sps::DFR_F, Sps::DFR_R, Sps::DFR_D, Sps::DBL_B, Sps::DBL_L, Sps::DBL_D, Sps::UBL_B, Sps::UBL_L, Sps::UBL_U, Sps::UBR_B, Sps::UBR_R, Sps::UBR_U, Sps::DBR_B, Sps::DBR_R, Sps::DBR_D }, // FL
-        { Sps::B, Sps::F, Sps::U, Sps::D, Sps::R, Sps::L, Sps::UR_U, Sps::UR_R, Sps::UL_U, Sps::UL_L, Sps::DL_D, Sps::DL_L, Sps::DR_D, Sps::DR_R, Sps::UB_B, Sps::UB_U, Sps::BL_B, Sps::BL_L, Sps::DB_B, Sps::DB_D, Sps::BR_B, Sps::BR_R, Sps::UF_F, Sps::UF_U, Sps::FL_F, Sps::FL_L, Sps::DF_F, Sps::DF_D, Sps::FR_F, Sps::FR_R, Sps::UBR_B, Sps::UBR_U, Sps::UBR_R, Sps::UBL_B, Sps::UBL_U, Sps::UBL_L, Sps::DBL_B, Sps::DBL_D, Sps::DBL_L, Sps::DBR_B, Sps::DBR_D, Sps::DBR_R, Sps::UFR_F, Sps::UFR_U, Sps::UFR_R, Sps::UFL_F, Sps::UFL_U, Sps::UFL_L, Sps::DFL_F, Sps::DFL_D, Sps::DFL_L, Sps::DFR_F, Sps::DFR_D, Sps::DFR_R }, // BU
-        { Sps::B, Sps::F, Sps::R, Sps::L, Sps::D, Sps::U, Sps::DR_R, Sps::DR_D, Sps::UR_R, Sps::UR_U, Sps::UL_L, Sps::UL_U, Sps::DL_L, Sps::DL_D, Sps::BR_B, Sps::BR_R, Sps::UB_B, Sps::UB_U, Sps::BL_B, Sps::BL_L, Sps::DB_B, Sps::DB_D, Sps::FR_F, Sps::FR_R, Sps::UF_F, Sps::UF_U, Sps::FL_F, Sps::FL_L, Sps::DF_F, Sps::DF_D, Sps::DBR_B, Sps::DBR_R, Sps::DBR_D, Sps::UBR_B, Sps::UBR_R, Sps::UBR_U, Sps::UBL_B, Sps::UBL_L, Sps::UBL_U, Sps::DBL_B, Sps::DBL_L, Sps::DBL_D, Sps::DFR_F, Sps::DFR_R, Sps::DFR_D, Sps::UFR_F, Sps::UFR_R, Sps::UFR_U, Sps::UFL_F, Sps::UFL_L, Sps::UFL_U, Sps::DFL_F, Sps::DFL_L, Sps::DFL_D }, // BR
-        { Sps::B, Sps::F, Sps::D, Sps::U, Sps::L, Sps::R, Sps::DL_D, Sps::DL_L, Sps::DR_D, Sps::DR_R, Sps::UR_U, Sps::UR_R, Sps::UL_U, Sps::UL_L, Sps::DB_B, Sps::DB_D, Sps::BR_B, Sps::BR_R, Sps::UB_B, Sps::UB_U, Sps::BL_B, Sps::BL_L, Sps::DF_F, Sps::DF_D, Sps::FR_F, Sps::FR_R, Sps::UF_F, Sps::UF_U, Sps::FL_F, Sps::FL_L, Sps::DBL_B, Sps::DBL_D, Sps::DBL_L, Sps::DBR_B, Sps::DBR_D, Sps::DBR_R, Sps::UBR_B, Sps::UBR_U, Sps::UBR_R, Sps::UBL_B, Sps::UBL_U, Sps::UBL_L, Sps::DFL_F, Sps::DFL_D, Sps::DFL_L, Sps::DFR_F, Sps::DFR_D, Sps::DFR_R, Sps::UFR_F, Sps::UFR_U, Sps::UFR_R, Sps::UFL_F, Sps::UFL_U, Sps::UFL_L }, // BD
-        { Sps::B, Sps::F, Sps::L, Sps::R, Sps::U, Sps::D, Sps::UL_L, Sps::UL_U, Sps::DL_L, Sps::DL_D, Sps::DR_R, Sps::DR_D, Sps::UR_R, Sps::UR_U, Sps::BL_B, Sps::BL_L, Sps::DB_B, Sps::DB_D, Sps::BR_B, Sps::BR_R, Sps::UB_B, Sps::UB_U, Sps::FL_F, Sps::FL_L, Sps::DF_F, Sps::DF_D, Sps::FR_F, Sps::FR_R, Sps::UF_F, Sps::UF_U, Sps::UBL_B, Sps::UBL_L, Sps::UBL_U, Sps::DBL_B, Sps::DBL_L, Sps::DBL_D, Sps::DBR_B, Sps::DBR_R, Sps::DBR_D, Sps::UBR_B, Sps::UBR_R, Sps::UBR_U, Sps::UFL_F, Sps::UFL_L, Sps::UFL_U, Sps::DFL_F, Sps::DFL_L, Sps::DFL_D, Sps::DFR_F, Sps::DFR_R, Sps::DFR_D, Sps::UFR_F, Sps::UFR_R, Sps::UFR_U }, // BL
-        { Sps::R, Sps::L, Sps::U, Sps::D, Sps::F, Sps::B, Sps::UF_U, Sps::UF_F, Sps::UB_U, Sps::UB_B, Sps::DB_D, Sps::DB_B, Sps::DF_D, Sps::DF_F, Sps::UR_R, Sps::UR_U, Sps::BR_R, Sps::BR_B, Sps::DR_R, Sps::DR_D, Sps::FR_R, Sps::FR_F, Sps::UL_L, Sps::UL_U, Sps::BL_L, Sps::BL_B, Sps::DL_L, Sps::DL_D, Sps::FL_L, Sps::FL_F, Sps::UFR_R, Sps::UFR_U, Sps::UFR_F, Sps::UBR_R, Sps::UBR_U, Sps::UBR_B, Sps::DBR_R, Sps::DBR_D, Sps::DBR_B, Sps::DFR_R, Sps::DFR_D, Sps::DFR_F, Sps::UFL_L, Sps::UFL_U, Sps::UFL_F, Sps::UBL_L, Sps::UBL_U, Sps::UBL_B, Sps::DBL_L, Sps::DBL_D, Sps::DBL_B, Sps::DFL_L, Sps::DFL_D, Sps::DFL_F }, // RU
-        { Sps::R, Sps::L, Sps::F, Sps::B, Sps::D, Sps::U, Sps::DF_F, Sps::DF_D, Sps::UF_F, Sps::UF_U, Sps::UB_B, Sps::UB_U, Sps::DB_B, Sps::DB_D, Sps::FR_R, Sps::FR_F, Sps::UR_R, Sps::UR_U, Sps::BR_R, Sps::BR_B, Sps::DR_R, Sps::DR_D, Sps::FL_L, Sps::FL_F, Sps::UL_L, Sps::UL_U, Sps::BL_L, Sps::BL_B, Sps::DL_L, Sps::DL_D, Sps::DFR_R, Sps::DFR_F, Sps::DFR_D, Sps::UFR_R, Sps::UFR_F, Sps::UFR_U, Sps::UBR_R, Sps::UBR_B, Sps::UBR_U, Sps::DBR_R, Sps::DBR_B, Sps::DBR_D, Sps::DFL_L, Sps::DFL_F, Sps::DFL_D, Sps::UFL_L, Sps::UFL_F, Sps::UFL_U, Sps::UBL_L, Sps::UBL_B, Sps::UBL_U, Sps::DBL_L, Sps::DBL_B, Sps::DBL_D }, // RF
-        { Sps::R, Sps::L, Sps::D, Sps::U, Sps::B, Sps::F, Sps::DB_D, Sps::DB_B, Sps::DF_D, Sps::DF_F, Sps::UF_U, Sps::UF_F, Sps::UB_U, Sps::UB_B, Sps::DR_R, Sps::DR_D, Sps::FR_R, Sps::FR_F, Sps::UR_R, Sps::UR_U, Sps::BR_R, Sps::BR_B, Sps::DL_L, Sps::DL_D, Sps::FL_L, Sps::FL_F, Sps::UL_L, Sps::UL_U, Sps::BL_L, Sps::BL_B, Sps::DBR_R, Sps::DBR_D, Sps::DBR_B, Sps::DFR_R, Sps::DFR_D, Sps::DFR_F, Sps::UFR_R, Sps::UFR_U, Sps::UFR_F, Sps::UBR_R, Sps::UBR_U, Sps::UBR_B, Sps::DBL_L, Sps::DBL_D, Sps::DBL_B, Sps::DFL_L, Sps::DFL_D, Sps::DFL_F, Sps::UFL_L, Sps::UFL_U, Sps::UFL_F, Sps::UBL_L, Sps::UBL_U, Sps::UBL_B }, // RD
-        { Sps::R, Sps::L, Sps::B, Sps::F, Sps::U, Sps::D, Sps::UB_B, Sps::UB_U, Sps::DB_B, Sps::DB_D, Sps::DF_F, Sps::DF_D, Sps::UF_F, Sps::UF_U, Sps::BR_R, Sps::BR_B, Sps::DR_R, Sps::DR_D, Sps::FR_R, Sps::FR_F, Sps::UR_R, Sps::UR_U, Sps::BL_L, Sps::BL_B, Sps::DL_L, Sps::DL_D, Sps::FL_L, Sps::FL_F, Sps::UL_L, Sps::UL_U, Sps::UBR_R, Sps::UBR_B, Sps::UBR_U, Sps::DBR_R, Sps::DBR_B, Sps::DBR_D, Sps::DFR_R, Sps::DFR_F, Sps::DFR_D, Sps::UFR_R, Sps::UFR_F, Sps::UFR_U, Sps::UBL_L, Sps::UBL_B, Sps::UBL_U, Sps::DBL_L, Sps::DBL_B, Sps::DBL_D, Sps::DFL_L, Sps::DFL_F, Sps::DFL_D, Sps::UFL_L, Sps::UFL_F, Sps::UFL_U }, // RB
-        { Sps::L, Sps::R, Sps::U, Sps::D, Sps::B, Sps::F, Sps::UB_U, Sps::UB_B, Sps::UF_U, Sps::UF_F, Sps::DF_D, Sps::DF_F, Sps::DB_D, Sps::DB_B, Sps::UL_L, Sps::UL_U, Sps::FL_L, Sps::FL_F, Sps::DL_L, Sps::DL_D, Sps::BL_L, Sps::BL_B, Sps::UR_R, Sps::UR_U, Sps::FR_R, Sps::FR_F, Sps::DR_R, Sps::DR_D, Sps::BR_R, Sps::BR_B, Sps::UBL_L, Sps::UBL_U, Sps::UBL_B, Sps::UFL_L, Sps::UFL_U, Sps::UFL_F, Sps::DFL_L, Sps::DFL_D, Sps::DFL_F, Sps::DBL_L, Sps::DBL_D, Sps::DBL_B, Sps::UBR_R, Sps::UBR_U, Sps::UBR_B, Sps::UFR_R, Sps::UFR_U, Sps::UFR_F, Sps::DFR_R, Sps::DFR_D, Sps::DFR_F, Sps::DBR_R, Sps::DBR_D, Sps::DBR_B }, // LU
-        { Sps::L, Sps::R, Sps::F, Sps::B, Sps::U, Sps::D, Sps::UF_F, Sps::UF_U, Sps::DF_F, Sps::DF_D, Sps::DB_B, Sps::DB_D, Sps::UB_B, Sps::UB_U, Sps::FL_L, Sps::FL_F, Sps::DL_L, Sps::DL_D, Sps::BL_L, Sps::BL_B, Sps::UL_L, Sps::UL_U, Sps::FR_R, Sps::FR_F, Sps::DR_R, Sps::DR_D, Sps::BR_R, Sps::BR_B, Sps::UR_R, Sps::UR_U, Sps::UFL_L, Sps::UFL_F, Sps::UFL_U, Sps::DFL_L, Sps::DFL_F, Sps::DFL_D, Sps::DBL_L, Sps::DBL_B, Sps::DBL_D, Sps::UBL_L, Sps::UBL_B, Sps::UBL_U, Sps::UFR_R, Sps::UFR_F, Sps::UFR_U, Sps::DFR_R, Sps::DFR_F, Sps::DFR_D, Sps::DBR_R, Sps::DBR_B, Sps::DBR_D, Sps::UBR_R, Sps::UBR_B, Sps::UBR_U }, // LF
-        { Sps::L, Sps::R, Sps::D, Sps::U, Sps::F, Sps::B, Sps::DF_D, Sps::DF_F, Sps::DB_D, Sps::DB_B, Sps::UB_U, Sps::UB_B, Sps::UF_U, Sps::UF_F, Sps::DL_L, Sps::DL_D, Sps::BL_L, Sps::BL_B, Sps::UL_L, Sps::UL_U, Sps::FL_L, Sps::FL_F, Sps::DR_R, Sps::DR_D, Sps::BR_R, Sps::BR_B, Sps::UR_R, Sps::UR_U, Sps::FR_R, Sps::FR_F, Sps::DFL_L, Sps::DFL_D, Sps::DFL_F, Sps::DBL_L, Sps::DBL_D, Sps::DBL_B, Sps::UBL_L, Sps::UBL_U, Sps::UBL_B, Sps::UFL_L, Sps::UFL_U, Sps::UFL_F, Sps::DFR_R, Sps::DFR_D, Sps::DFR_F, Sps::DBR_R, Sps::DBR_D, Sps::DBR_B, Sps::UBR_R, Sps::UBR_U, Sps::UBR_B, Sps::UFR_R, Sps::UFR_U, Sps::UFR_F }, // LD
-        { Sps::L, Sps::R, Sps::B, Sps::F, Sps::D, Sps::U, Sps::DB_B, Sps::DB_D, Sps::UB_B, Sps::UB_U, Sps::UF_F, Sps::UF_U, Sps::DF_F, Sps::DF_D, Sps::BL_L, Sps::BL_B, Sps::UL_L, Sps::UL_U, Sps::FL_L, Sps::FL_F, Sps::DL_L, Sps::DL_D, Sps::BR_R, Sps::BR_B, Sps::UR_R, Sps::UR_U, Sps::FR_R, Sps::FR_F, Sps::DR_R, Sps::DR_D, Sps::DBL_L, Sps::DBL_B, Sps::DBL_D, Sps::UBL_L, Sps::UBL_B, Sps::UBL_U, Sps::UFL_L, Sps::UFL_F, Sps::UFL_U, Sps::DFL_L, Sps::DFL_F, Sps::DFL_D, Sps::DBR_R, Sps::DBR_B, Sps::DBR_D, Sps::UBR_R, Sps::UBR_B, Sps::UBR_U, Sps::UFR_R, Sps::UFR_F, Sps::UFR_U, Sps::DFR_R, Sps::DFR_F, Sps::DFR_D }  // LB
-    };
-	
+	// Piece positions from spin and absolut piece positions
+	constexpr FixedTable2<Pcp, 24, 26> Cube::pcp_Absolut = InverseTable<Pcp>(app_Positions);
+
 	// Absolut sticker positions from spin and sticker positions
-	const Asp Cube::asp_Positions[24][54] =
+	constexpr Asp Cube::asp_Positions[24][54] =
 	{
 		{ Asp::U, Asp::D, Asp::F, Asp::B, Asp::R, Asp::L, Asp::FR_F, Asp::FR_R, Asp::FL_F, Asp::FL_L, Asp::BL_B, Asp::BL_L, Asp::BR_B, Asp::BR_R, Asp::UF_U, Asp::UF_F, Asp::UL_U, Asp::UL_L, Asp::UB_U, Asp::UB_B, Asp::UR_U, Asp::UR_R, Asp::DF_D, Asp::DF_F, Asp::DL_D, Asp::DL_L, Asp::DB_D, Asp::DB_B, Asp::DR_D, Asp::DR_R, Asp::UFR_U, Asp::UFR_F, Asp::UFR_R, Asp::UFL_U, Asp::UFL_F, Asp::UFL_L, Asp::UBL_U, Asp::UBL_B, Asp::UBL_L, Asp::UBR_U, Asp::UBR_B, Asp::UBR_R, Asp::DFR_D, Asp::DFR_F, Asp::DFR_R, Asp::DFL_D, Asp::DFL_F, Asp::DFL_L, Asp::DBL_D, Asp::DBL_B, Asp::DBL_L, Asp::DBR_D, Asp::DBR_B, Asp::DBR_R },
 		{ Asp::U, Asp::D, Asp::L, Asp::R, Asp::F, Asp::B, Asp::FL_L, Asp::FL_F, Asp::BL_L, Asp::BL_B, Asp::BR_R, Asp::BR_B, Asp::FR_R, Asp::FR_F, Asp::UL_U, Asp::UL_L, Asp::UB_U, Asp::UB_B, Asp::UR_U, Asp::UR_R, Asp::UF_U, Asp::UF_F, Asp::DL_D, Asp::DL_L, Asp::DB_D, Asp::DB_B, Asp::DR_D, Asp::DR_R, Asp::DF_D, Asp::DF_F, Asp::UFL_U, Asp::UFL_L, Asp::UFL_F, Asp::UBL_U, Asp::UBL_L, Asp::UBL_B, Asp::UBR_U, Asp::UBR_R, Asp::UBR_B, Asp::UFR_U, Asp::UFR_R, Asp::UFR_F, Asp::DFL_D, Asp::DFL_L, Asp::DFL_F, Asp::DBL_D, Asp::DBL_L, Asp::DBL_B, Asp::DBR_D, Asp::DBR_R, Asp::DBR_B, Asp::DFR_D, Asp::DFR_R, Asp::DFR_F },
@@ -394,564 +309,129 @@ namespace grcube3
 		{ Asp::B, Asp::F, Asp::R, Asp::L, Asp::D, Asp::U, Asp::DR_R, Asp::DR_D, Asp::UR_R, Asp::UR_U, Asp::UL_L, Asp::UL_U, Asp::DL_L, Asp::DL_D, Asp::BR_B, Asp::BR_R, Asp::UB_B, Asp::UB_U, Asp::BL_B, Asp::BL_L, Asp::DB_B, Asp::DB_D, Asp::FR_F, Asp::FR_R, Asp::UF_F, Asp::UF_U, Asp::FL_F, Asp::FL_L, Asp::DF_F, Asp::DF_D, Asp::DBR_B, Asp::DBR_R, Asp::DBR_D, Asp::UBR_B, Asp::UBR_R, Asp::UBR_U, Asp::UBL_B, Asp::UBL_L, Asp::UBL_U, Asp::DBL_B, Asp::DBL_L, Asp::DBL_D, Asp::DFR_F, Asp::DFR_R, Asp::DFR_D, Asp::UFR_F, Asp::UFR_R, Asp::UFR_U, Asp::UFL_F, Asp::UFL_L, Asp::UFL_U, Asp::DFL_F, Asp::DFL_L, Asp::DFL_D },
 		{ Asp::L, Asp::R, Asp::B, Asp::F, Asp::D, Asp::U, Asp::DB_B, Asp::DB_D, Asp::UB_B, Asp::UB_U, Asp::UF_F, Asp::UF_U, Asp::DF_F, Asp::DF_D, Asp::BL_L, Asp::BL_B, Asp::UL_L, Asp::UL_U, Asp::FL_L, Asp::FL_F, Asp::DL_L, Asp::DL_D, Asp::BR_R, Asp::BR_B, Asp::UR_R, Asp::UR_U, Asp::FR_R, Asp::FR_F, Asp::DR_R, Asp::DR_D, Asp::DBL_L, Asp::DBL_B, Asp::DBL_D, Asp::UBL_L, Asp::UBL_B, Asp::UBL_U, Asp::UFL_L, Asp::UFL_F, Asp::UFL_U, Asp::DFL_L, Asp::DFL_F, Asp::DFL_D, Asp::DBR_R, Asp::DBR_B, Asp::DBR_D, Asp::UBR_R, Asp::UBR_B, Asp::UBR_U, Asp::UFR_R, Asp::UFR_F, Asp::UFR_U, Asp::DFR_R, Asp::DFR_F, Asp::DFR_D }
 	};
+
+	// Sticker positions from spin and absolut sticker positions
+	constexpr FixedTable2<Sps, 24, 54> Cube::sps_Absolut = InverseTable<Sps>(asp_Positions);
+
 	
-    void Cube::U() // Movement U
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_U(); c_U(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_D(); c_D(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_F(); c_F(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_B(); c_B(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_R(); c_R(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_L(); c_L(); return;
-        }
-    }
-    
-    void Cube::U2()  // Movement U2
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_U2(); c_U2(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_D2(); c_D2(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_F2(); c_F2(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_B2(); c_B2(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_R2(); c_R2(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_L2(); c_L2(); return;
-        }
-    }
-    
-    void Cube::Up()  // Movement U'
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_Up(); c_Up(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_Dp(); c_Dp(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_Fp(); c_Fp(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_Bp(); c_Bp(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_Rp(); c_Rp(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_Lp(); c_Lp(); return;
-        }
-    }
-    
-    void Cube::D()  // Movement D
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_D(); c_D(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_U(); c_U(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_B(); c_B(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_F(); c_F(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_L(); c_L(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_R(); c_R(); return;
-        }
-    }
-    
-    void Cube::D2()  // Movement D2
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_D2(); c_D2(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_U2(); c_U2(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_B2(); c_B2(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_F2(); c_F2(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_L2(); c_L2(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_R2(); c_R2(); return;
-        }
-    }
-    
-    void Cube::Dp()  // Movement D'
-    {
-        switch (spin)
-        {
-            case Spn::UF:
-            case Spn::UR:
-            case Spn::UB:
-            case Spn::UL: e_Dp(); c_Dp(); return;
-            case Spn::DF:
-            case Spn::DR:
-            case Spn::DB:
-            case Spn::DL: e_Up(); c_Up(); return;
-            case Spn::FU:
-            case Spn::FR:
-            case Spn::FD:
-            case Spn::FL: e_Bp(); c_Bp(); return;
-            case Spn::BU:
-            case Spn::BR:
-            case Spn::BD:
-            case Spn::BL: e_Fp(); c_Fp(); return;
-            case Spn::RU:
-            case Spn::RF:
-            case Spn::RD:
-            case Spn::RB: e_Lp(); c_Lp(); return;
-            case Spn::LU:
-            case Spn::LF:
-            case Spn::LD:
-            case Spn::LB: e_Rp(); c_Rp(); return;
-        }
-    }
-    
-    void Cube::F()  // Movement F
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_U(); c_U(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_D(); c_D(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_F(); c_F(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_B(); c_B(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_R(); c_R(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_L(); c_L(); return;
-        }
-    }
-    
-    void Cube::F2()  // Movement F2
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_U2(); c_U2(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_D2(); c_D2(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_F2(); c_F2(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_B2(); c_B2(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_R2(); c_R2(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_L2(); c_L2(); return;
-        }
-    }
-    
-    void Cube::Fp()  // Movement F'
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_Up(); c_Up(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_Dp(); c_Dp(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_Fp(); c_Fp(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_Bp(); c_Bp(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_Rp(); c_Rp(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_Lp(); c_Lp(); return;
-        }
-    }
-    
-    void Cube::B()  // Movement B
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_D(); c_D(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_U(); c_U(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_B(); c_B(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_F(); c_F(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_L(); c_L(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_R(); c_R(); return;
-        }
-    }
-    
-    void Cube::B2()  // Movement B2
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_D2(); c_D2(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_U2(); c_U2(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_B2(); c_B2(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_F2(); c_F2(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_L2(); c_L2(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_R2(); c_R2(); return;
-        }
-    }
-    
-    void Cube::Bp()  // Movement B'
-    {
-        switch (spin)
-        {
-            case Spn::FU:
-            case Spn::BU:
-            case Spn::RU:
-            case Spn::LU: e_Dp(); c_Dp(); return;
-            case Spn::FD:
-            case Spn::BD:
-            case Spn::RD:
-            case Spn::LD: e_Up(); c_Up(); return;
-            case Spn::UF:
-            case Spn::DF:
-            case Spn::RF:
-            case Spn::LF: e_Bp(); c_Bp(); return;
-            case Spn::UB:
-            case Spn::DB:
-            case Spn::RB:
-            case Spn::LB: e_Fp(); c_Fp(); return;
-            case Spn::UR:
-            case Spn::DR:
-            case Spn::FR:
-            case Spn::BR: e_Lp(); c_Lp(); return;
-            case Spn::UL:
-            case Spn::DL:
-            case Spn::FL:
-            case Spn::BL: e_Rp(); c_Rp(); return;
-        }
-    }
-    
-    void Cube::R()  // Movement R
-    {
-        switch (spin)
-        {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_U(); c_U(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_D(); c_D(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_F(); c_F(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_B(); c_B(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_R(); c_R(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_L(); c_L(); return;
-        }
-    }
-    
-    void Cube::R2()  // Movement R2
-    {
-        switch (spin)
-        {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_U2(); c_U2(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_D2(); c_D2(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_F2(); c_F2(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_B2(); c_B2(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_R2(); c_R2(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_L2(); c_L2(); return;
-        }
-    }
-    
-    void Cube::Rp()  // Movement R'
-    {
-        switch (spin)
-        {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_Up(); c_Up(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_Dp(); c_Dp(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_Fp(); c_Fp(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_Bp(); c_Bp(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_Rp(); c_Rp(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_Lp(); c_Lp(); return;
-        }
-    }
-    
-    void Cube::L()  // Movement L
-    {
-        switch (spin)
-        {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_D(); c_D(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_U(); c_U(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_B(); c_B(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_F(); c_F(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_L(); c_L(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_R(); c_R(); return;
-        }
-    }
-    
-    void Cube::L2()  // Movement L2
-    {
-        switch (spin)
-        {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_D2(); c_D2(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_U2(); c_U2(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_B2(); c_B2(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_F2(); c_F2(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_L2(); c_L2(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_R2(); c_R2(); return;
-        }
-    }
-    
-    void Cube::Lp()  // Movement L'
+    // Absolut external layer turn from spin and external layer turn [Spin][Turn relative to the spin]
+    constexpr Stp Cube::stp_Absolut[24][19] =
+    {
+        { Stp::NONE, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2 }, // UF
+        { Stp::NONE, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2 }, // UR
+        { Stp::NONE, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2 }, // UB
+        { Stp::NONE, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2 }, // UL
+        { Stp::NONE, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2 }, // DF
+        { Stp::NONE, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2 }, // DR
+        { Stp::NONE, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2 }, // DB
+        { Stp::NONE, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2 }, // DL
+        { Stp::NONE, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2 }, // FU
+        { Stp::NONE, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2 }, // FR
+        { Stp::NONE, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2 }, // FD
+        { Stp::NONE, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2 }, // FL
+        { Stp::NONE, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2 }, // BU
+        { Stp::NONE, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2 }, // BR
+        { Stp::NONE, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2 }, // BD
+        { Stp::NONE, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2 }, // BL
+        { Stp::NONE, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2 }, // RU
+        { Stp::NONE, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2 }, // RF
+        { Stp::NONE, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2 }, // RD
+        { Stp::NONE, Stp::R, Stp::Rp, Stp::R2, Stp::L, Stp::Lp, Stp::L2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2 }, // RB
+        { Stp::NONE, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2 }, // LU
+        { Stp::NONE, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2, Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2 }, // LF
+        { Stp::NONE, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2, Stp::F, Stp::Fp, Stp::F2, Stp::B, Stp::Bp, Stp::B2 }, // LD
+        { Stp::NONE, Stp::L, Stp::Lp, Stp::L2, Stp::R, Stp::Rp, Stp::R2, Stp::B, Stp::Bp, Stp::B2, Stp::F, Stp::Fp, Stp::F2, Stp::D, Stp::Dp, Stp::D2, Stp::U, Stp::Up, Stp::U2 }  // LB
+    };
+
+    // Absolut layer turns: the slice turns are found from the absolut turns of their two external layers
+    static constexpr FixedTable2<uint8_t, 24, LAYER_TURNS> AbsolutLayerTurns(const Stp (&Absolut)[24][19])
     {
-        switch (spin)
+        FixedTable2<uint8_t, 24, LAYER_TURNS> Turns{};
+        for (uint sp = 0u; sp < 24u; sp++)
         {
-            case Spn::FR:
-            case Spn::BL:
-            case Spn::RB:
-            case Spn::LF: e_Dp(); c_Dp(); return;
-            case Spn::FL:
-            case Spn::BR:
-            case Spn::RF:
-            case Spn::LB: e_Up(); c_Up(); return;
-            case Spn::UL:
-            case Spn::DR:
-            case Spn::RU:
-            case Spn::LD: e_Bp(); c_Bp(); return;
-            case Spn::UR:
-            case Spn::DL:
-            case Spn::RD:
-            case Spn::LU: e_Fp(); c_Fp(); return;
-            case Spn::UF:
-            case Spn::DB:
-            case Spn::FD:
-            case Spn::BU: e_Lp(); c_Lp(); return;
-            case Spn::UB:
-            case Spn::DF:
-            case Spn::FU:
-            case Spn::BD: e_Rp(); c_Rp(); return;
+            for (uint t = 0u; t < SLICE_TURNS_FIRST; t++) Turns[sp][t] = static_cast<uint8_t>(Absolut[sp][t]);
+            for (uint t = 0u; t < LAYER_TURNS - SLICE_TURNS_FIRST; t++)
+            {
+                const Stp T1 = Absolut[sp][static_cast<int>(stp_SliceTurns[t][0])], T2 = Absolut[sp][static_cast<int>(stp_SliceTurns[t][1])];
+                for (uint a = 0u; a < LAYER_TURNS - SLICE_TURNS_FIRST; a++)
+                    if ((stp_SliceTurns[a][0] == T1 && stp_SliceTurns[a][1] == T2) || (stp_SliceTurns[a][0] == T2 && stp_SliceTurns[a][1] == T1))
+                        Turns[sp][SLICE_TURNS_FIRST + t] = static_cast<uint8_t>(SLICE_TURNS_FIRST + a);
+            }
         }
+        return Turns;
     }
+
+    constexpr FixedTable2<uint8_t, 24, LAYER_TURNS> Cube::lyt_Absolut = AbsolutLayerTurns(stp_Absolut);
+
+    // Steps as layer turns (relatives to the spin) followed by a cube turn
+    const Cube::StepTurns Cube::stt_Steps[static_cast<int>(Stp::PARENTHESIS_CLOSE_9_REP) + 1] =
+    {
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, true }, // NONE
+        { LayerTurn(Stp::U), spn_Turns_NONE, true }, // U
+        { LayerTurn(Stp::Up), spn_Turns_NONE, true }, // Up
+        { LayerTurn(Stp::U2), spn_Turns_NONE, true }, // U2
+        { LayerTurn(Stp::D), spn_Turns_NONE, true }, // D
+        { LayerTurn(Stp::Dp), spn_Turns_NONE, true }, // Dp
+        { LayerTurn(Stp::D2), spn_Turns_NONE, true }, // D2
+        { LayerTurn(Stp::F), spn_Turns_NONE, true }, // F
+        { LayerTurn(Stp::Fp), spn_Turns_NONE, true }, // Fp
+        { LayerTurn(Stp::F2), spn_Turns_NONE, true }, // F2
+        { LayerTurn(Stp::B), spn_Turns_NONE, true }, // B
+        { LayerTurn(Stp::Bp), spn_Turns_NONE, true }, // Bp
+        { LayerTurn(Stp::B2), spn_Turns_NONE, true }, // B2
+        { LayerTurn(Stp::R), spn_Turns_NONE, true }, // R
+        { LayerTurn(Stp::Rp), spn_Turns_NONE, true }, // Rp
+        { LayerTurn(Stp::R2), spn_Turns_NONE, true }, // R2
+        { LayerTurn(Stp::L), spn_Turns_NONE, true }, // L
+        { LayerTurn(Stp::Lp), spn_Turns_NONE, true }, // Lp
+        { LayerTurn(Stp::L2), spn_Turns_NONE, true }, // L2
+        { LayerTurn(Stp::D), spn_Turns_y, true }, // u
+        { LayerTurn(Stp::Dp), spn_Turns_yp.Data, true }, // up
+        { LayerTurn(Stp::D2), spn_Turns_y2.Data, true }, // u2
+        { LayerTurn(Stp::U), spn_Turns_yp.Data, true }, // d
+        { LayerTurn(Stp::Up), spn_Turns_y, true }, // dp
+        { LayerTurn(Stp::U2), spn_Turns_y2.Data, true }, // d2
+        { LayerTurn(Stp::B), spn_Turns_z, true }, // f
+        { LayerTurn(Stp::Bp), spn_Turns_zp.Data, true }, // fp
+        { LayerTurn(Stp::B2), spn_Turns_z2.Data, true }, // f2
+        { LayerTurn(Stp::F), spn_Turns_zp.Data, true }, // b
+        { LayerTurn(Stp::Fp), spn_Turns_z, true }, // bp
+        { LayerTurn(Stp::F2), spn_Turns_z2.Data, true }, // b2
+        { LayerTurn(Stp::L), spn_Turns_x, true }, // r
+        { LayerTurn(Stp::Lp), spn_Turns_xp.Data, true }, // rp
+        { LayerTurn(Stp::L2), spn_Turns_x2.Data, true }, // r2
+        { LayerTurn(Stp::R), spn_Turns_xp.Data, true }, // l
+        { LayerTurn(Stp::Rp), spn_Turns_x, true }, // lp
+        { LayerTurn(Stp::R2), spn_Turns_x2.Data, true }, // l2
+        { LayerTurn(Stp::E), spn_Turns_yp.Data, true }, // E
+        { LayerTurn(Stp::Ep), spn_Turns_y, true }, // Ep
+        { LayerTurn(Stp::E2), spn_Turns_y2.Data, true }, // E2
+        { LayerTurn(Stp::S), spn_Turns_z, true }, // S
+        { LayerTurn(Stp::Sp), spn_Turns_zp.Data, true }, // Sp
+        { LayerTurn(Stp::S2), spn_Turns_z2.Data, true }, // S2
+        { LayerTurn(Stp::M), spn_Turns_xp.Data, true }, // M
+        { LayerTurn(Stp::Mp), spn_Turns_x, true }, // Mp
+        { LayerTurn(Stp::M2), spn_Turns_x2.Data, true }, // M2
+        { LayerTurn(Stp::NONE), spn_Turns_x, true }, // x
+        { LayerTurn(Stp::NONE), spn_Turns_xp.Data, true }, // xp
+        { LayerTurn(Stp::NONE), spn_Turns_x2.Data, true }, // x2
+        { LayerTurn(Stp::NONE), spn_Turns_y, true }, // y
+        { LayerTurn(Stp::NONE), spn_Turns_yp.Data, true }, // yp
+        { LayerTurn(Stp::NONE), spn_Turns_y2.Data, true }, // y2
+        { LayerTurn(Stp::NONE), spn_Turns_z, true }, // z
+        { LayerTurn(Stp::NONE), spn_Turns_zp.Data, true }, // zp
+        { LayerTurn(Stp::NONE), spn_Turns_z2.Data, true }, // z2
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, true }, // PARENTHESIS_OPEN
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, true }, // PARENTHESIS_CLOSE_1_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_2_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_3_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_4_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_5_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_6_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_7_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }, // PARENTHESIS_CLOSE_8_REP
+        { LayerTurn(Stp::NONE), spn_Turns_NONE, false }  // PARENTHESIS_CLOSE_9_REP
+    };
 	
     // Set cube spin
     void Cube::SetSpin(const Spn s)
@@ -975,72 +455,13 @@ namespace grcube3
     // Returns false if the step is a close parentheses with more than one repetition
     bool Cube::ApplyStep(const Stp s)
     {
-        switch (s)
-        {
-            case Stp::U:  U();  return true;
-            case Stp::Up: Up(); return true;
-            case Stp::U2: U2(); return true;
-            case Stp::D:  D();  return true;
-            case Stp::Dp: Dp(); return true;
-            case Stp::D2: D2(); return true;
-            case Stp::F:  F();  return true;
-            case Stp::Fp: Fp(); return true;
-            case Stp::F2: F2(); return true;
-            case Stp::B:  B();  return true;
-            case Stp::Bp: Bp(); return true;
-            case Stp::B2: B2(); return true;
-            case Stp::R:  R();  return true;
-            case Stp::Rp: Rp(); return true;
-            case Stp::R2: R2(); return true;
-            case Stp::L:  L();  return true;
-            case Stp::Lp: Lp(); return true;
-            case Stp::L2: L2(); return true;
-            
-            case Stp::x:  x();  return true;
-            case Stp::xp: xp(); return true;
-            case Stp::x2: x2(); return true;
-            case Stp::y:  y();  return true;
-            case Stp::yp: yp(); return true;
-            case Stp::y2: y2(); return true;
-            case Stp::z:  z();  return true;
-            case Stp::zp: zp(); return true;
-            case Stp::z2: z2(); return true;
-
-            case Stp::u:  D();  y();  return true;
-            case Stp::up: Dp(); yp(); return true;
-            case Stp::u2: D2(); y2(); return true;
-            case Stp::d:  U();  yp(); return true;
-            case Stp::dp: Up(); y();  return true;
-            case Stp::d2: U2(); y2(); return true;
-            case Stp::f:  B();  z();  return true;
-            case Stp::fp: Bp(); zp(); return true;
-            case Stp::f2: B2(); z2(); return true;
-            case Stp::b:  F();  zp(); return true;
-            case Stp::bp: Fp(); z();  return true;
-            case Stp::b2: F2(); z2(); return true;
-            case Stp::r:  L();  x();  return true;
-            case Stp::rp: Lp(); xp(); return true;
-            case Stp::r2: L2(); x2(); return true;
-            case Stp::l:  R();  xp(); return true;
-            case Stp::lp: Rp(); x();  return true;
-            case Stp::l2: R2(); x2(); return true;
-
-            case Stp::E:  U();  Dp(); yp(); return true; // E -> As layer D
-            case Stp::Ep: Up(); D();  y();  return true; // E'
-            case Stp::E2: U2(); D2(); y2(); return true; // E2
-            case Stp::S:  Fp(); B();  z();  return true; // S -> As layer F
-            case Stp::Sp: F();  Bp(); zp(); return true; // S'
-            case Stp::S2: F2(); B2(); z2(); return true; // S2
-            case Stp::M:  R();  Lp(); xp(); return true; // M -> As layer L
-            case Stp::Mp: Rp(); L();  x();  return true; // M'
-            case Stp::M2: R2(); L2(); x2(); return true; // M2
-
-            case Stp::NONE:
-            case Stp::PARENTHESIS_OPEN:
-            case Stp::PARENTHESIS_CLOSE_1_REP: return true;
-
-            default: return false; // Close parentheses step with more than one repetition
-        }
+        const StepTurns& ST = stt_Steps[static_cast<int>(s)];
+
+        const uint T = lyt_Absolut[static_cast<int>(spin)][ST.Turn];
+        e_Turn(T); c_Turn(T);
+        spin = ST.Spins[static_cast<int>(spin)];
+
+        return ST.Valid;
     }
     
     // Get the sticker in the given sticker position
@@ -1237,15 +658,26 @@ namespace grcube3
     {
         std::vector<Pcp> PList;
         AddToPositionsList(PG, PList);
-        for (const auto PP : PList) if (!CheckOrientation(PP)) return false;
-        return true;
+        return CheckOrientation(PList);
     }
 
     // Check if a list of pieces are orientated
     bool Cube::CheckOrientation(const std::vector<Pcp>& PList) const
     {
-        for (const auto PP : PList) if (!CheckOrientation(PP)) return false;
-        return true;
+        S64 EMask, CMask;
+        GetMasksOrientation(PList, EMask, CMask);
+        return IsOriented(EMask, CMask);
+    }
+
+    // Get the direction masks for check the orientation of a list of pieces positions
+    void Cube::GetMasksOrientation(const std::vector<Pcp>& PList, S64& EMask, S64& CMask)
+    {
+        EMask = CMask = 0ull;
+        for (const auto PP : PList)
+        {
+            if (IsEdge(PP)) EMask |= GetMaskEdgeDirection(PcpToEdp(PP));
+            else if (IsCorner(PP)) CMask |= GetMaskCornerDirection(PcpToCnp(PP));
+        }
     }
 
     /* Edges oriented (http://cube.rider.biz/zz.php?p=eoline)
@@ -2057,6 +1489,14 @@ namespace grcube3
 
     // Check if the cube is solved for the given group of pieces
     bool Cube::IsSolved(const Pgr SP) const
+    {
+        S64 EMask, CMask;
+        GetMasksSolved(SP, EMask, CMask);
+        return IsSolved(EMask, CMask);
+    }
+
+    // Get the masks for check if the pieces in a group of pieces positions are solved
+    void Cube::GetMasksSolved(const Pgr SP, S64& EMask, S64& CMask)
     {
         std::vector<Pcp> PList;
         std::vector<Edp> EList;
@@ -2069,7 +1509,8 @@ namespace grcube3
             else if (IsCorner(P)) CList.push_back(PcpToCnp(P));
         }
 
-        return IsSolved(GetMaskSolvedEdges(EList), GetMaskSolvedCorners(CList));
+        EMask = GetMaskSolvedEdges(EList);
+        CMask = GetMaskSolvedCorners(CList);
     }
 
     // Check if the cube is solved for the given groups of pieces
@@ -2088,21 +1529,28 @@ namespace grcube3
 
     // Check if the cube is solved for the given layer
     bool Cube::IsSolved(const Lyr Ly) const
+    {
+        S64 EMask, CMask;
+        return GetMasksSolved(Ly, EMask, CMask) && IsSolved(EMask, CMask);
+    }
+
+    // Get the masks for check if the pieces in a layer are solved
+    bool Cube::GetMasksSolved(const Lyr Ly, S64& EMask, S64& CMask)
     {
         switch (Ly)
         {
-        case Lyr::U: return IsSolved(EMASK_U, CMASK_U);
-        case Lyr::D: return IsSolved(EMASK_D, CMASK_D);
-        case Lyr::F: return IsSolved(EMASK_F, CMASK_F);
-        case Lyr::B: return IsSolved(EMASK_B, CMASK_B);
-        case Lyr::R: return IsSolved(EMASK_R, CMASK_R);
-        case Lyr::L: return IsSolved(EMASK_L, CMASK_L);
-
-        case Lyr::E: return IsSolved(EMASK_E, CMASK_E);
-        case Lyr::M: return IsSolved(EMASK_M, CMASK_M);
-        case Lyr::S: return IsSolved(EMASK_S, CMASK_S);
+        case Lyr::U: EMask = EMASK_U; CMask = CMASK_U; return true;
+        case Lyr::D: EMask = EMASK_D; CMask = CMASK_D; return true;
+        case Lyr::F: EMask = EMASK_F; CMask = CMASK_F; return true;
+        case Lyr::B: EMask = EMASK_B; CMask = CMASK_B; return true;
+        case Lyr::R: EMask = EMASK_R; CMask = CMASK_R; return true;
+        case Lyr::L: EMask = EMASK_L; CMask = CMASK_L; return true;
+
+        case Lyr::E: EMask = EMASK_E; CMask = CMASK_E; return true;
+        case Lyr::M: EMask = EMASK_M; CMask = CMASK_M; return true;
+        case Lyr::S: EMask = EMASK_S; CMask = CMASK_S; return true;
         
-        default: return false;
+        default: EMask = CMask = 0ull; return false;
         }
     }
 
@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+
 #include "cube_definitions.h"
 #include "edges.h"
 #include "corners.h"
@@ -29,6 +32,30 @@
 
 namespace grcube3
 {
+	// Compact 128-bit key for a cube status (edges and corners status, the spin is not included)
+	// Equal keys are the same cube status, so the key can be used in caches, transposition tables and sets
+	struct CubeKey
+	{
+		S64 Edges;
+		S64 Corners;
+
+		bool operator==(const CubeKey& K) const { return Edges == K.Edges && Corners == K.Corners; }
+		bool operator!=(const CubeKey& K) const { return Edges != K.Edges || Corners != K.Corners; }
+
+		// Total ordering (edges first), for ordered containers and sorting
+		bool operator<(const CubeKey& K) const { return Edges < K.Edges || (Edges == K.Edges && Corners < K.Corners); }
+
+		// Hash value (both halves are mixed, as most of the bits in the status are fixed)
+		std::size_t Hash() const
+		{
+			S64 h = Edges * 0x9E3779B97F4A7C15u + Corners;
+			h ^= h >> 33; h *= 0xFF51AFD7ED558CCDu;
+			h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53u;
+			h ^= h >> 33;
+			return static_cast<std::size_t>(h);
+		}
+	};
+
 	// 3x3x3 Rubik's cube class
 	class Cube: public c_Edges, public c_Corners
 	{
@@ -63,10 +90,13 @@ namespace grcube3
 		bool ApplyAlgorithm(const Algorithm&);
 
 		// Equal operator -> corners & edges must match, spin is not important
-		bool operator==(Cube& rhcube) const { return edges == rhcube.GetEdgesStatus() && corners == rhcube.GetCornersStatus(); }
+		bool operator==(const Cube& rhcube) const { return edges == rhcube.edges && corners == rhcube.corners; }
 
         // Not equal operator - corners & edges must not match, spin is not important
-        bool operator!=(Cube& rhcube) const { return edges != rhcube.GetEdgesStatus() || corners != rhcube.GetCornersStatus(); }
+        bool operator!=(const Cube& rhcube) const { return edges != rhcube.edges || corners != rhcube.corners; }
+
+		// Get the cube status key (spin is not important, as in the equal operator)
+		CubeKey GetKey() const { return { edges, corners }; }
 
         // Get corners status
         S64 GetCornersStatus() const { return corners; }
@@ -86,6 +116,9 @@ namespace grcube3
 		// Get edges direction status
         S64 GetEdgesDirStatus() const { return edges & EMASK_DIR_DATA; }
 
+		// Set edges and corners status (no checks, a valid cube status is expected)
+		void SetStatus(const S64 E, const S64 C) { edges = E; corners = C; }
+
         // Get cube spin
         Spn GetSpin() const { return spin; }
 
@@ -158,6 +191,12 @@ namespace grcube3
         // Check if a list of pieces are orientated
         bool CheckOrientation(const std::vector<Pcp>&) const;
 
+        // Check if the pieces in the positions coded in the given direction masks are orientated for the given spin
+        bool IsOriented(const S64 EMask, const S64 CMask, const Spn sp) const { return IsOrientedEdges(EMask, sp) && IsOrientedCorners(CMask, sp); }
+
+        // Check if the pieces in the positions coded in the given direction masks are orientated (see GetMasksOrientation)
+        bool IsOriented(const S64 EMask, const S64 CMask) const { return IsOriented(EMask, CMask, spin); }
+
 		// Get the solved face of the sticker in the given sticker position
         Fce GetSolvedFace(const Sps P) const { return fce_Stickers[static_cast<int>(P)]; }
 
@@ -226,6 +265,15 @@ namespace grcube3
         // Add pieces positions from groups of pieces positions to a list
 		static bool AddToPositionsList(const std::vector<Pgr>&, std::vector<Pcp>&);
 
+        // Get the direction masks for check the orientation of a list of pieces positions (centers are ignored)
+        static void GetMasksOrientation(const std::vector<Pcp>&, S64& EMask, S64& CMask);
+
+        // Get the masks for check if the pieces in a group of pieces positions are solved (centers are ignored)
+        static void GetMasksSolved(const Pgr, S64& EMask, S64& CMask);
+
+        // Get the masks for check if the pieces in a layer are solved (false if the layer is not valid)
+        static bool GetMasksSolved(const Lyr, S64& EMask, S64& CMask);
+
         // Get the char for representing a layer
 		static char GetLayerChar(const Lyr Ly) { return char_Layers[static_cast<int>(Ly)]; }
 
@@ -342,6 +390,9 @@ namespace grcube3
 		
 		// Get the absolut sticker position from an sticker position for the given spin
 		static Asp AbsFromPosition(const Sps as, const Spn sp) { return asp_Positions[static_cast<int>(sp)][static_cast<int>(as)]; }
+
+		// Get the absolut external layer turn from an external layer turn for the given spin (Stp::NONE to Stp::L2)
+		static Stp GetAbsolutTurn(const Stp s, const Spn sp) { return stp_Absolut[static_cast<int>(sp)][static_cast<int>(s)]; }
 		
 	private:
 		
@@ -374,23 +425,34 @@ namespace grcube3
         // Cube z2 turn
         void z2() { spin = spn_Turns_z2[static_cast<int>(spin)]; }
 
-        void U(); void U2(); void Up(); // Cube U slice movements
-        void D(); void D2(); void Dp(); // Cube D slice movements
-        void F(); void F2(); void Fp(); // Cube F slice movements
-        void B(); void B2(); void Bp(); // Cube B slice movements
-        void R(); void R2(); void Rp(); // Cube R slice movements
-        void L(); void L2(); void Lp(); // Cube L slice movements
+        // Step as a layer turn (external layer or slice, relative to the cube spin) followed by a cube turn
+        struct StepTurns
+        {
+            uint Turn; // Layer turn index (see LAYER_TURNS), 0 if not needed
+            const Spn* Spins; // Spin after the step for each current spin
+            bool Valid; // False for close parentheses with more than one repetition
+        };
+
+        // Array with the decomposition of each step in layer turn and cube turn
+        const static StepTurns stt_Steps[static_cast<int>(Stp::PARENTHESIS_CLOSE_9_REP) + 1];
+
+        // Absolut external layer turn from spin and external layer turn (Stp::NONE to Stp::L2)
+        const static Stp stp_Absolut[24][19];
 
-		// Arrays to follow spins when a cube has a turn
+        // Absolut layer turn index from spin and layer turn index (generated from stp_Absolut, see LAYER_TURNS)
+        const static FixedTable2<uint8_t, 24, LAYER_TURNS> lyt_Absolut;
+
+		// Arrays to follow spins when a cube has a turn (the x2, xp, y2, yp, z2 and zp arrays are generated from x, y and z)
+        const static Spn spn_Turns_NONE[24];
         const static Spn spn_Turns_x[24];
-        const static Spn spn_Turns_x2[24];
-        const static Spn spn_Turns_xp[24];
+        const static FixedTable<Spn, 24> spn_Turns_x2;
+        const static FixedTable<Spn, 24> spn_Turns_xp;
         const static Spn spn_Turns_y[24];
-        const static Spn spn_Turns_y2[24];
-        const static Spn spn_Turns_yp[24];
+        const static FixedTable<Spn, 24> spn_Turns_y2;
+        const static FixedTable<Spn, 24> spn_Turns_yp;
         const static Spn spn_Turns_z[24];
-        const static Spn spn_Turns_z2[24];
-        const static Spn spn_Turns_zp[24];
+        const static FixedTable<Spn, 24> spn_Turns_z2;
+        const static FixedTable<Spn, 24> spn_Turns_zp;
 
         // Two turns array for get an spin from an inital spin
         const static Stp stp_Turns[24][24][2];
@@ -417,30 +479,39 @@ namespace grcube3
 		const static char char_Layers[10];
 
         // Array with spins string representation
-        const static std::string string_Spins[24];
+        const static char string_Spins[24][3];
 
         // Array with pieces string representation
-        const static std::string string_Pieces[26];
+        const static char string_Pieces[26][4];
 
         // Array with stickers string representation
-        const static std::string string_Stickers[54];
+        const static char string_Stickers[54][6];
 
         // Strings with all possible directions for pieces
-        const static std::string string_Directions[6];
+        const static char string_Directions[6][5];
 		
 		// Lyr from spin and slice
 		const static Lyr lyr_Slice[24][10];
 		
-		// Piece positions from spin and absolut piece positions
-		const static Pcp pcp_Absolut[24][26];
+		// Piece positions from spin and absolut piece positions (inverse of app_Positions)
+		const static FixedTable2<Pcp, 24, 26> pcp_Absolut;
 		
 		// Absolute piece positions from spin and piece positions
         const static App app_Positions[24][26];
 		
-		// Sticker positions from spin and absolut sticker positions
-		const static Sps sps_Absolut[24][54];
+		// Sticker positions from spin and absolut sticker positions (inverse of asp_Positions)
+		const static FixedTable2<Sps, 24, 54> sps_Absolut;
 		
 		// Absolut sticker positions from spin and sticker positions
 		const static Asp asp_Positions[24][54];
 	};
 }
+
+// Hash specialization for the cube key (unordered containers)
+namespace std
+{
+	template<> struct hash<grcube3::CubeKey>
+	{
+		std::size_t operator()(const grcube3::CubeKey& K) const { return K.Hash(); }
+	};
+}
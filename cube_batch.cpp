@@ -0,0 +1,113 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "cube_batch.h"
+
+namespace grcube3
+{
+	// Batch with the cube after each delta
+	CubeBatch::CubeBatch(const Cube& C, const std::vector<CubeDelta>& Deltas)
+	{
+		Edges.assign(Deltas.size(), C.GetEdgesStatus());
+		Corners.assign(Deltas.size(), C.GetCornersStatus());
+		Spins.assign(Deltas.size(), C.GetSpin());
+
+		for (uint n = 0u; n < GetSize(); n++) Deltas[n].Apply(&Edges[n], &Corners[n], &Spins[n], 1u);
+	}
+
+	// Batch with the cube after each algorithm
+	CubeBatch::CubeBatch(const Cube& C, const std::vector<Algorithm>& Algs)
+	{
+		Reserve(static_cast<uint>(Algs.size()));
+		for (const auto& A : Algs)
+		{
+			Cube CA = C;
+			if (!CA.ApplyAlgorithm(A))
+			{ // Algorithm have parentheses with more than one repetition, must be developed
+				CA = C;
+				CA.ApplyAlgorithm(A.GetDeveloped(false));
+			}
+			Add(CA);
+		}
+	}
+
+	// Get the cube in the given index
+	Cube CubeBatch::GetCube(const uint n) const
+	{
+		Cube C;
+		C.SetSpin(Spins[n]);
+		C.SetStatus(Edges[n], Corners[n]);
+		return C;
+	}
+
+	// Apply the algorithm to each cube in the batch
+	void CubeBatch::ApplyAlgorithm(const Algorithm& A)
+	{
+		if (IsEmpty()) return;
+
+		uint n = 1u;
+		while (n < GetSize() && Spins[n] == Spins[0]) n++;
+
+		if (n == GetSize()) { Apply(CubeDelta(A, Spins[0])); return; } // Same spin for all cubes, a single delta
+
+		// Different spins: each cube with the delta for its spin (applied one by one, as the end spin of a delta
+		// can be the start spin of another)
+		CubeDelta Deltas[24];
+		bool Built[24] = { false };
+		for (n = 0u; n < GetSize(); n++)
+		{
+			const int sp = static_cast<int>(Spins[n]);
+			if (!Built[sp]) { Deltas[sp] = CubeDelta(A, Spins[n]); Built[sp] = true; }
+			Deltas[sp].Apply(&Edges[n], &Corners[n], &Spins[n], 1u);
+		}
+	}
+
+	// Get the index of the first cube solved for the given pieces masks
+	uint CubeBatch::FindSolved(const S64 EMask, const S64 CMask) const
+	{
+		const S64 ES = SolvedEdges & EMask, CS = SolvedCorners & CMask;
+		for (uint n = 0u; n < GetSize(); n++) if ((Edges[n] & EMask) == ES && (Corners[n] & CMask) == CS) return n;
+		return GetSize();
+	}
+
+	// Get a flag for each cube solved for the given pieces masks
+	uint CubeBatch::CheckSolved(std::vector<uint8_t>& Flags, const S64 EMask, const S64 CMask) const
+	{
+		const S64 ES = SolvedEdges & EMask, CS = SolvedCorners & CMask;
+		Flags.resize(GetSize());
+
+		uint Solved = 0u;
+		for (uint n = 0u; n < GetSize(); n++) // No branches, so the loop can be vectorized
+		{
+			Flags[n] = static_cast<uint8_t>(((Edges[n] & EMask) == ES) & ((Corners[n] & CMask) == CS));
+			Solved += Flags[n];
+		}
+		return Solved;
+	}
+
+	// Get the index of the first cube with the given pieces status
+	uint CubeBatch::Find(const S64 EStatus, const S64 CStatus) const
+	{
+		for (uint n = 0u; n < GetSize(); n++) if (Edges[n] == EStatus && Corners[n] == CStatus) return n;
+		return GetSize();
+	}
+}
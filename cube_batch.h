@@ -0,0 +1,109 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "cube_definitions.h"
+#include "cube.h"
+#include "algorithm.h"
+#include "cube_delta.h"
+
+namespace grcube3
+{
+	// Batch of cubes with a structure of arrays layout (edges status, corners status and spin in separate arrays)
+	// Used to apply an algorithm to many cubes, or many algorithms to a cube, and check the results in tight loops
+	// over the status arrays, instead of a full cube copy for each check
+	class CubeBatch
+	{
+	public:
+		// Empty batch
+		CubeBatch() {}
+
+		// Batch with the cube after each delta (one cube, N algorithms)
+		// A delta with a start spin different from the cube spin leaves the cube unchanged
+		CubeBatch(const Cube&, const std::vector<CubeDelta>&);
+
+		// Batch with the cube after each algorithm (one cube, N algorithms)
+		CubeBatch(const Cube&, const std::vector<Algorithm>&);
+
+		// Add a cube to the batch
+		void Add(const Cube& C) { Edges.push_back(C.GetEdgesStatus()); Corners.push_back(C.GetCornersStatus()); Spins.push_back(C.GetSpin()); }
+
+		// Remove all cubes
+		void Clear() { Edges.clear(); Corners.clear(); Spins.clear(); }
+
+		// Reserve space for the given number of cubes
+		void Reserve(const uint n) { Edges.reserve(n); Corners.reserve(n); Spins.reserve(n); }
+
+		// Get the number of cubes in the batch
+		uint GetSize() const { return static_cast<uint>(Spins.size()); }
+
+		// Check if the batch is empty
+		bool IsEmpty() const { return Spins.empty(); }
+
+		// Get the cube in the given index
+		Cube GetCube(const uint) const;
+
+		// Get the edges status of the cube in the given index
+		S64 GetEdgesStatus(const uint n) const { return Edges[n]; }
+
+		// Get the corners status of the cube in the given index
+		S64 GetCornersStatus(const uint n) const { return Corners[n]; }
+
+		// Get the spin of the cube in the given index
+		Spn GetSpin(const uint n) const { return Spins[n]; }
+
+		// Apply the delta to each cube in the batch (N cubes, one algorithm)
+		// Only the cubes in the delta start spin are changed, returns the number of cubes changed
+		uint Apply(const CubeDelta& D) { return D.Apply(Edges.data(), Corners.data(), Spins.data(), GetSize()); }
+
+		// Apply the algorithm to each cube in the batch (a delta is computed for each spin in the batch)
+		void ApplyAlgorithm(const Algorithm&);
+
+		// Check if the cube in the given index is solved for the given pieces masks (see Cube::GetMasksSolved)
+		bool IsSolved(const uint n, const S64 EMask, const S64 CMask) const
+		{
+			return (Edges[n] & EMask) == (SolvedEdges & EMask) && (Corners[n] & CMask) == (SolvedCorners & CMask);
+		}
+
+		// Get the index of the first cube solved for the given pieces masks (GetSize() if none)
+		uint FindSolved(const S64 EMask, const S64 CMask) const;
+
+		// Get a flag for each cube solved for the given pieces masks (1 if solved), returns the number of cubes solved
+		uint CheckSolved(std::vector<uint8_t>&, const S64 EMask, const S64 CMask) const;
+
+		// Get the index of the first cube with the given pieces status, the spin is not checked (GetSize() if none)
+		uint Find(const S64 EStatus, const S64 CStatus) const;
+
+		// Get the index of the first cube with the same pieces status as the given cube, the spin is not checked
+		uint Find(const Cube& C) const { return Find(C.GetEdgesStatus(), C.GetCornersStatus()); }
+
+	private:
+		static const S64 SolvedEdges = 0x0000BA9876543210ULL; // Edges status for a solved cube
+		static const S64 SolvedCorners = 0x0706050403020100ULL; // Corners status for a solved cube
+
+		std::vector<S64> Edges, Corners; // Pieces status for each cube
+		std::vector<Spn> Spins; // Spin for each cube
+	};
+}
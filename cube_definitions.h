@@ -23,6 +23,14 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+
+// Face turns as SSSE3 bytes shuffles when the compiler targets them (-mssse3, -march=native, /arch:AVX...)
+// Otherwise (or with GRCUBE3_NO_SIMD defined) the portable bitfield permutations are used
+#if !defined(GRCUBE3_NO_SIMD) && (defined(__SSSE3__) || defined(__AVX__)) && (defined(__x86_64__) || defined(_M_X64))
+#define GRCUBE3_SIMD_TURNS
+#include <tmmintrin.h>
+#endif
 
 namespace grcube3
 {
@@ -66,6 +74,31 @@ namespace grcube3
 	using S64 = std::uint64_t; // 64 bits status
 	using M16 = std::uint16_t; // 16 bits masks
 	using uint = unsigned int;
+
+	// Rotate left the bits of a 64 bits status (a right shift is a left rotation if the moved bits don't wrap)
+	inline S64 RotateLeft(const S64 S, const uint R) { return (S << R) | (S >> ((64u - R) & 63u)); }
+
+	// Fixed size table that can be built by a constexpr function (C arrays can't be returned), so the tables derived from
+	// other tables are generated at compile time. Indexed as a C array: T[a][b] for FixedTable<FixedTable<T, B>, A>
+	template <typename T, std::size_t N> struct FixedTable
+	{
+		T Data[N];
+
+		constexpr const T& operator[](const std::size_t i) const { return Data[i]; }
+		constexpr T& operator[](const std::size_t i) { return Data[i]; }
+	};
+
+	template <typename T, std::size_t N1, std::size_t N2> using FixedTable2 = FixedTable<FixedTable<T, N2>, N1>;
+	template <typename T, std::size_t N1, std::size_t N2, std::size_t N3> using FixedTable3 = FixedTable<FixedTable2<T, N2, N3>, N1>;
+
+	// Inverse of a positions table (for each spin, the position for each absolut position)
+	template <typename R, typename T, std::size_t N> constexpr FixedTable2<R, 24, N> InverseTable(const T (&Positions)[24][N])
+	{
+		FixedTable2<R, 24, N> Inverse{};
+		for (std::size_t sp = 0u; sp < 24u; sp++)
+			for (std::size_t p = 0u; p < N; p++) Inverse[sp][static_cast<std::size_t>(Positions[sp][p])] = static_cast<R>(p);
+		return Inverse;
+	}
 	
 	// Enumerators
 	
@@ -316,6 +349,25 @@ namespace grcube3
 		PARENTHESIS_CLOSE_8_REP, 	// Close parenthesis with eight repetitions
 		PARENTHESIS_CLOSE_9_REP 	// Close parenthesis with nine repetitions
 	};
+
+	// Layer turns coded in the edges and corners turn tables: the external layers turns (Stp::NONE to Stp::L2, same index)
+	// followed by the slice turns (Stp::E to Stp::M2), all of them absolut (for the default spin)
+	constexpr uint LAYER_TURNS = 28u;
+	constexpr uint SLICE_TURNS_FIRST = 19u;
+
+	// Slice turns as two external layers turns, from Stp::E to Stp::M2 (the spin change is not included)
+	constexpr Stp stp_SliceTurns[9][2] =
+	{
+		{ Stp::U, Stp::Dp }, { Stp::Up, Stp::D }, { Stp::U2, Stp::D2 }, // E, E', E2
+		{ Stp::Fp, Stp::B }, { Stp::F, Stp::Bp }, { Stp::F2, Stp::B2 }, // S, S', S2
+		{ Stp::R, Stp::Lp }, { Stp::Rp, Stp::L }, { Stp::R2, Stp::L2 }  // M, M', M2
+	};
+
+	// Layer turn index for an external layer turn (Stp::NONE to Stp::L2) or a slice turn (Stp::E to Stp::M2)
+	constexpr uint LayerTurn(const Stp S)
+	{
+		return S <= Stp::L2 ? static_cast<uint>(S) : SLICE_TURNS_FIRST + static_cast<uint>(S) - static_cast<uint>(Stp::E);
+	}
 	
 	enum class Rng // All possible ranges (types) for movements (steps)
 	{ 
@@ -433,4 +485,5 @@ namespace grcube3
 
     // Supported metrics
     enum class Metrics { Movements, HTM, QTM, STM, QSTM, ETM, ATM, PTM, HTM15, OBTM };
+    constexpr uint METRICS_NUMBER = 10u; // Number of supported metrics
 }
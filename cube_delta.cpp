@@ -0,0 +1,161 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "cube_delta.h"
+
+namespace grcube3
+{
+	// Corners twist for each direction (first index: 1 for corner positions UFR, UBL, DFL and DBR, else 0)
+	// Directions are composed as twists, FB and RL are clockwise or counterclockwise twists depending on the position
+	// (also twist to direction, as the conversion is its own inverse)
+	static const S64 c_Twists[2][3] = { { 0u, 2u, 1u }, { 0u, 1u, 2u } };
+
+	// Corner positions UFR, UBL, DFL and DBR
+	static const uint c_Tetrad[8] = { 1u, 0u, 1u, 0u, 0u, 1u, 0u, 1u };
+
+	// Delta for an algorithm applied from the given spin
+	CubeDelta::CubeDelta(const Algorithm& A, const Spn sp)
+	{
+		Cube C;
+		C.SetSpin(sp);
+		if (!C.ApplyAlgorithm(A))
+		{ // Algorithm have parentheses with more than one repetition, must be developed
+			C.Reset();
+			C.SetSpin(sp);
+			C.ApplyAlgorithm(A.GetDeveloped(false));
+		}
+		Edges = C.GetEdgesStatus();
+		Corners = C.GetCornersStatus();
+		StartSpin = sp;
+		EndSpin = C.GetSpin();
+	}
+
+	// Apply the delta to the cube
+	bool CubeDelta::Apply(Cube& C) const
+	{
+		if (C.GetSpin() != StartSpin) return false;
+
+		S64 E, Cr;
+		Compose(C.GetEdgesStatus(), C.GetCornersStatus(), Edges, Corners, E, Cr);
+		C.SetStatus(E, Cr);
+		C.SetSpin(EndSpin);
+		return true;
+	}
+
+	// Apply the delta to N cubes given as status arrays
+	// The delta is the same for all cubes, so the source position and the direction change for each position are
+	// computed once and each cube is a fixed sequence of shifts and masks (the corners twist as a 2 bits lookup)
+	uint CubeDelta::Apply(S64* EdgesStatus, S64* CornersStatus, Spn* Spins, const uint N) const
+	{
+		uint EFrom[12], CFrom[8];
+		S64 CTwist[8];
+
+		for (uint p = 0u; p < 12u; p++) EFrom[p] = (Edges >> (4u * p)) & 0xFu;
+		const S64 EFlip = Edges & 0x0FFF000000000000ULL;
+
+		for (uint p = 0u; p < 8u; p++)
+		{
+			CFrom[p] = (Corners >> (8u * p)) & 0x7u;
+			const S64 Twist = c_Twists[c_Tetrad[p]][(Corners >> (8u * p + 4u)) & 0x3u];
+			CTwist[p] = 0u;
+			for (uint d = 0u; d < 3u; d++) CTwist[p] |= c_Twists[c_Tetrad[p]][(c_Twists[c_Tetrad[CFrom[p]]][d] + Twist) % 3u] << (2u * d);
+		}
+
+		uint Changed = 0u;
+		for (uint n = 0u; n < N; n++)
+		{
+			if (Spins[n] != StartSpin) continue;
+
+			const S64 E1 = EdgesStatus[n], C1 = CornersStatus[n];
+			S64 E = 0u, C = 0u;
+			for (uint p = 0u; p < 12u; p++) E |= (((E1 >> (4u * EFrom[p])) & 0xFu) << (4u * p)) | (((E1 >> (48u + EFrom[p])) & 0x1u) << (48u + p));
+			for (uint p = 0u; p < 8u; p++)
+			{
+				const S64 Piece = C1 >> (8u * CFrom[p]);
+				C |= ((Piece & 0x7u) | (((CTwist[p] >> (2u * ((Piece >> 4) & 0x3u))) & 0x3u) << 4)) << (8u * p);
+			}
+
+			EdgesStatus[n] = E ^ EFlip;
+			CornersStatus[n] = C;
+			Spins[n] = EndSpin;
+			Changed++;
+		}
+		return Changed;
+	}
+
+	// Append a delta
+	bool CubeDelta::Append(const CubeDelta& D)
+	{
+		if (D.StartSpin != EndSpin) return false;
+
+		Compose(Edges, Corners, D.Edges, D.Corners, Edges, Corners);
+		EndSpin = D.EndSpin;
+		return true;
+	}
+
+	// Get the inverse delta: each piece returns to the position it comes from, with the opposite direction change
+	CubeDelta CubeDelta::GetInverse() const
+	{
+		CubeDelta Inv(EndSpin);
+		Inv.EndSpin = StartSpin;
+		Inv.Edges = Inv.Corners = 0u;
+
+		for (uint p = 0u; p < 12u; p++)
+		{
+			const uint From = (Edges >> (4u * p)) & 0xFu;
+			Inv.Edges |= (static_cast<S64>(p) << (4u * From)) | (((Edges >> (48u + p)) & 0x1u) << (48u + From));
+		}
+
+		for (uint p = 0u; p < 8u; p++)
+		{
+			const uint From = (Corners >> (8u * p)) & 0x7u, Dir = (Corners >> (8u * p + 4u)) & 0x3u;
+			const S64 InvTwist = (3u - c_Twists[c_Tetrad[p]][Dir]) % 3u;
+			Inv.Corners |= (static_cast<S64>(p) | (c_Twists[c_Tetrad[From]][InvTwist] << 4)) << (8u * From);
+		}
+
+		return Inv;
+	}
+
+	// Edges and corners status after applying the second status changes to the first status
+	// The piece in each position comes from the position given by the second status, with both direction changes
+	void CubeDelta::Compose(const S64 E1, const S64 C1, const S64 E2, const S64 C2, S64& E, S64& C)
+	{
+		S64 EAux = 0u, CAux = 0u;
+
+		for (uint p = 0u; p < 12u; p++)
+		{
+			const uint From = (E2 >> (4u * p)) & 0xFu;
+			EAux |= (((E1 >> (4u * From)) & 0xFu) << (4u * p)) | ((((E1 >> (48u + From)) ^ (E2 >> (48u + p))) & 0x1u) << (48u + p));
+		}
+
+		for (uint p = 0u; p < 8u; p++)
+		{
+			const uint From = (C2 >> (8u * p)) & 0x7u;
+			const S64 Piece = C1 >> (8u * From);
+			const S64 Twist = (c_Twists[c_Tetrad[From]][(Piece >> 4) & 0x3u] + c_Twists[c_Tetrad[p]][(C2 >> (8u * p + 4u)) & 0x3u]) % 3u;
+			CAux |= ((Piece & 0x7u) | (c_Twists[c_Tetrad[p]][Twist] << 4)) << (8u * p);
+		}
+
+		E = EAux;
+		C = CAux;
+	}
+}
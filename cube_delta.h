@@ -0,0 +1,92 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include "cube_definitions.h"
+#include "cube.h"
+#include "algorithm.h"
+
+namespace grcube3
+{
+	// Precompiled effect of an algorithm over the cube (pieces permutation, orientation and spin change)
+	// The effect is computed once applying the algorithm to a solved cube, and then it can be applied to any cube
+	// with the same start spin in a single composition, whatever the algorithm length
+	class CubeDelta
+	{
+	public:
+		// Identity delta (no changes) for the given spin
+		CubeDelta(const Spn sp = Spn::Default) { Edges = SolvedEdges; Corners = SolvedCorners; StartSpin = EndSpin = sp; }
+
+		// Delta for an algorithm applied from the given spin (parentheses are developed)
+		CubeDelta(const Algorithm&, const Spn = Spn::Default);
+
+		// Delta from a solved cube in default spin to the given cube
+		CubeDelta(const Cube& C) { Edges = C.GetEdgesStatus(); Corners = C.GetCornersStatus(); StartSpin = Spn::Default; EndSpin = C.GetSpin(); }
+
+		// Apply the delta to the cube (same result as applying the algorithm)
+		// Returns false if the cube spin is not the delta start spin and cube status remains unchanged
+		bool Apply(Cube&) const;
+
+		// Apply the delta to N cubes given as status arrays (structure of arrays, see CubeBatch)
+		// Only the cubes in the delta start spin are changed, returns the number of cubes changed
+		uint Apply(S64* EdgesStatus, S64* CornersStatus, Spn* Spins, const uint N) const;
+
+		// Append a delta (the current delta followed by the given one)
+		// Returns false if the given delta start spin is not the current delta end spin and delta remains unchanged
+		bool Append(const CubeDelta&);
+
+		// Get the inverse delta (undo the current delta, from the end spin to the start spin)
+		CubeDelta GetInverse() const;
+
+		// Equal operator -> same pieces permutation and orientation, same spins
+		bool operator==(const CubeDelta& D) const { return Edges == D.Edges && Corners == D.Corners && StartSpin == D.StartSpin && EndSpin == D.EndSpin; }
+
+		// Not equal operator
+		bool operator!=(const CubeDelta& D) const { return !(*this == D); }
+
+		// Check if the delta don't change any piece (spin can change)
+		bool IsIdentity() const { return Edges == SolvedEdges && Corners == SolvedCorners; }
+
+		// Get the edges status for the delta applied to a solved cube
+		S64 GetEdgesStatus() const { return Edges; }
+
+		// Get the corners status for the delta applied to a solved cube
+		S64 GetCornersStatus() const { return Corners; }
+
+		// Get the spin needed to apply the delta
+		Spn GetStartSpin() const { return StartSpin; }
+
+		// Get the spin after applying the delta
+		Spn GetEndSpin() const { return EndSpin; }
+
+	private:
+		static const S64 SolvedEdges = 0x0000BA9876543210ULL; // Edges status for a solved cube
+		static const S64 SolvedCorners = 0x0706050403020100ULL; // Corners status for a solved cube
+
+		S64 Edges, Corners; // Pieces status after applying the delta to a solved cube
+		Spn StartSpin, EndSpin; // Spins before and after applying the delta
+
+		// Edges and corners status after applying the second status changes to the first status
+		static void Compose(const S64 E1, const S64 C1, const S64 E2, const S64 C2, S64& E, S64& C);
+	};
+}
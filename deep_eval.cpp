@@ -44,6 +44,9 @@ namespace grcube3
 		UsedCores = 0; // Not used cores yet
 		Cores = GetSystemCores(); // For multithreading
         RootBranches = 0u; // Will be updated during the evaluation
+		Scheduler = nullptr; // No evaluation running
+		Budget = nullptr; // No limits by default
+		StopRequested = false;
         SetNewScramble(scr); // Apply the scramble
         ResetGroups(); // No groups of pieces to evaluate
 	}
@@ -60,7 +63,7 @@ namespace grcube3
 			if (Cube::IsEdge(P)) G.EMask |= Cube::GetMaskSolvedEdge(Cube::PcpToEdp(P));
 			else if (Cube::IsCorner(P)) G.CMask |= Cube::GetMaskSolvedCorner(Cube::PcpToCnp(P));
 		}
-		G.Orient = OrientedGroup; // List of pieces to orient
+		Cube::GetMasksOrientation(OrientedGroup, G.OrientEMask, G.OrientCMask); // Pieces to orient
 		G.Spin = sp; // Spin, relevant only for orientation
 		
 		Groups.push_back(G);
@@ -136,19 +139,23 @@ namespace grcube3
 	void DeepEval::UpdateRootData()
 	{
 		Roots.clear();
+		RootFlags.clear();
 		
 		Algorithm A; // Empty algorithm
 
 		std::vector<bool> Flags0 = SolvedFlagsBase; // Flags for depth 0 results
-		CheckAlg(A, Flags0); // Depth 0 results
+		CheckAlg(0u, CubeBase, Flags0, 0u); // Depth 0 results
 		
 		for (const auto S1 : MainSteps)
 		{
 			A.Clear();
 			A.Append(S1);
 
+			Cube C1 = CubeBase;
+			C1.ApplyStep(S1);
+
 			std::vector<bool> Flags1 = Flags0; // Flags for depth 1 results
-			CheckAlg(A, Flags1); // Depth 1 results
+			CheckAlg(1u, C1, Flags1, 0u); // Depth 1 results
 			
 			for (const auto S2 : MainSteps)
 			{
@@ -159,8 +166,11 @@ namespace grcube3
 				if (A.GetSize() != 2u) continue;
 				if (Algorithm::OppositeSteps(A[0], A[1]) && A[0] > A[1]) continue; // "D U2" is the same than "U2 D" 
 				
+				Cube C2 = C1;
+				C2.ApplyStep(A[1]);
+
 				std::vector<bool> Flags2 = Flags1; // Flags for depth 2 results
-				CheckAlg(A, Flags2); // Depth 2 results
+				CheckAlg(2u, C2, Flags2, 0u); // Depth 2 results
 			
 				for (const auto S3 : MainSteps)
 				{
@@ -172,8 +182,11 @@ namespace grcube3
 					if (A.GetSize() != 3u) continue;
 					if (Algorithm::OppositeSteps(A[1], A[2]) && A[1] > A[2]) continue; // "F D U2" is the same than "F U2 D" 
 					
+					Cube C3 = C2;
+					C3.ApplyStep(A[2]);
+
 					std::vector<bool> Flags3 = Flags2; // Flags for depth 3 results
-					CheckAlg(A, Flags3); // Depth 3 results
+					CheckAlg(3u, C3, Flags3, 0u); // Depth 3 results
 					
 					Roots.push_back(A);
 					RootFlags.push_back(Flags3);
@@ -189,56 +202,80 @@ namespace grcube3
 	{
 		const auto time_eval_start = std::chrono::system_clock::now();
 
+		if (UseThreads >= 0) UsedCores = (UseThreads == 0) || (UseThreads >= Cores) ? Cores : UseThreads; // Multithreading
+		else UsedCores = 1u; // Without multithreading (for debugging, slower)
+
+		Stats.Prepare(UsedCores, MaxDepth + 1u); // Root levels are evaluated in the first thread
+
 		UpdateRootData();
 
-		if (RootBranches == 0u) return;
+		StopRequested = false;
 
-		if (UseThreads >= 0) // Multithreading
-		{
-			UsedCores = (UseThreads == 0) || (UseThreads >= Cores) ? Cores : UseThreads;
+		if (RootBranches == 0u) return;
 
-			std::vector<std::thread> Pool; // Threads pool
+		if (Budget != nullptr && !Budget->Spend(0u)) { StopRequested = true; return; } // Budget exhausted by previous searches
 
-			for (uint nc = 0; nc < UsedCores; nc++) Pool.push_back(std::thread(&DeepEval::RunThread, this, nc)); // Add a thread per core
-            for (auto& t : Pool) t.join(); // Wait for all threads
-		}
-        else // Without multithreading (for debugging, slower)
+		// Roots are queued in reverse order, as each thread takes the newest task from his own queue
+		WorkStealingScheduler<EvalTask> WS(UsedCores);
+		EvalTask RootTask;
+		for (uint n = RootBranches; n-- > 0u;)
 		{
-            for (uint n = 0; n < Roots.size(); n++) RunEvaluation(Roots[n], RootFlags[n]);
-			UsedCores = -1;
+			RootTask.Path.Clear();
+			RootTask.Path.Push(Roots[n]);
+			RootTask.C = CubeBase;
+			RootTask.C.ApplyAlgorithm(Roots[n]);
+			RootTask.Flags = RootFlags[n];
+			WS.Push(n % UsedCores, RootTask);
 		}
 
+		// Solve flags for each depth, allocated once per thread
+		std::vector<std::vector<std::vector<bool>>> FlagsStacks(UsedCores, std::vector<std::vector<bool>>(MaxDepth + 1u, SolvedFlagsBase));
+		ThreadNodes.assign(UsedCores, NodesCounter());
+
+		Scheduler = &WS;
+		WS.Run([this, &FlagsStacks](const uint Thread, EvalTask& T) { RunEvaluation(T.Path, T.C, T.Flags, FlagsStacks[Thread], Thread); }, UseThreads >= 0);
+		Scheduler = nullptr;
+
+		if (Budget != nullptr) for (auto& TN : ThreadNodes) Budget->Flush(TN);
+
+		ThreadsBusyTime = WS.GetBusyTimes();
+		ThreadsIdleTime = WS.GetIdleTimes();
+		Stats.AddTimes(ThreadsBusyTime, std::chrono::duration<double>(std::chrono::system_clock::now() - time_eval_start).count());
+
+		if (UseThreads < 0) UsedCores = -1;
+
 		const std::chrono::duration<double> eval_elapsed_seconds = std::chrono::system_clock::now() - time_eval_start;
         Time = eval_elapsed_seconds.count();
 	}
-	
-    // Run search a thread
-    void DeepEval::RunThread(const uint NCore) { for (uint n = NCore; n < RootBranches; n += UsedCores) RunEvaluation(Roots[n], RootFlags[n]); }
     
 	// Recursive evaluation code
-    void DeepEval::RunEvaluation(const Algorithm& A, const std::vector<bool>& Flags)
+    void DeepEval::RunEvaluation(SearchPath& Path, const Cube& C, const std::vector<bool>& Flags, std::vector<std::vector<bool>>& FlagsStack, const uint Thread)
 	{
-		std::vector<bool> NewFlags = Flags; // Copy the solve flags for this branch
-		CheckAlg(A, NewFlags); // Check if current algorithm solves or orient the pieces
-		if (A.GetSize() < MaxDepth) NextLevel(A, NewFlags);  // Launch the branch for the next level of the evaluation
+		std::vector<bool>& NewFlags = FlagsStack[Path.GetSize()]; // Copy the solve flags for this branch (no allocation, same size)
+		NewFlags = Flags;
+		CheckAlg(Path.GetSize(), C, NewFlags, Thread); // Check if current algorithm solves or orient the pieces
+		if (Budget != nullptr && !Budget->Count(ThreadNodes[Thread])) StopRequested.store(true, std::memory_order_relaxed);
+		if (Path.GetSize() < MaxDepth && !StopRequested.load(std::memory_order_relaxed)) NextLevel(Path, C, NewFlags, FlagsStack, Thread);  // Launch the branch for the next level of the evaluation
     }
 	
-	// Check if an algorithm solve or orient the pieces
-    inline void DeepEval::CheckAlg(const Algorithm& A, std::vector<bool>& Flags)
+	// Check if an algorithm solve or orient the pieces (the cube must have the scramble and the algorithm already applied)
+    inline void DeepEval::CheckAlg(const uint CurrentDepth, const Cube& C, std::vector<bool>& Flags, const uint Thread)
 	{
-		Cube CubeTest = CubeBase;
-		CubeTest.ApplyAlgorithm(A);
+		Stats.Count(Thread, CurrentDepth, Sts::NODES);
 
-		const uint CurrentDepth = A.GetSize();
-		
 		if (CurrentDepth < Results.size())
 		{
 			for (uint i = 0u; i < Groups.size(); i++)
 			{
-				CubeTest.SetSpin(Groups[i].Spin);
+				if (Flags[i]) continue; // Already solved upper in the branch
+
+				Stats.Count(Thread, CurrentDepth, Sts::CHECKS);
+				if (!C.IsSolved(Groups[i].EMask, Groups[i].CMask)) continue;
+				Stats.Count(Thread, CurrentDepth, Sts::MASK_HITS);
 
-				if (!Flags[i] && CubeTest.IsSolved(Groups[i].EMask, Groups[i].CMask) && CubeTest.CheckOrientation(Groups[i].Orient))
+				if (C.IsOriented(Groups[i].OrientEMask, Groups[i].OrientCMask, Groups[i].Spin)) // Orientation for the group spin
 				{
+					Stats.Count(Thread, CurrentDepth, Sts::SOLVES);
 					std::lock_guard<std::mutex> guard(SearchMutex);
 					Results[CurrentDepth][i]++;
 					Flags[i] = true; // Set the solve flag for this branch
@@ -248,15 +285,27 @@ namespace grcube3
 	}
 	
 	// Prepare the branches for the next level of the evaluation
-    inline void DeepEval::NextLevel(const Algorithm& A, const std::vector<bool>& Flags)
+    inline void DeepEval::NextLevel(SearchPath& Path, const Cube& C, const std::vector<bool>& Flags, std::vector<std::vector<bool>>& FlagsStack, const uint Thread)
 	{
-		const Stp LastStep = A.Last();
+		const bool CanSplit = Scheduler != nullptr && Path.GetSize() + 2u < MaxDepth; // Only branches with some levels below are given to other threads
+		static const CanonicalSequences& MainRuns = CanonicalSequences::Get(std::vector<Stp>(MainSteps.begin(), MainSteps.end()));
 
 		for (const auto S : MainSteps)
 		{
-			if (Algorithm::OppositeSteps(LastStep, S) && LastStep > S) continue; // As in an algorithm "... U D ..." branch is the same than "... D U ..." branch, compute only one.
-			Algorithm NewA = A;
-			if (!NewA.AppendShrink(S)) RunEvaluation(NewA, Flags); // Continue the search only on a longer algorithm (shorter or equal lenght means that will be calculated upper in the tree)
+			if (!Path.IsCanonical(S, MainRuns)) continue; // Only a branch for the sequences with the same effect ("U D" and "D U", "U D U" and "U2 D"...)
+			Cube C2 = C; // Only the new step is applied to the cube
+			C2.ApplyStep(S);
+			Path.Push(S);
+			if (CanSplit && Scheduler->IsHungry()) // Some thread is waiting for work, give it this branch
+			{
+				EvalTask T;
+				T.Path = Path;
+				T.C = C2;
+				T.Flags = Flags;
+				Scheduler->Push(Thread, T);
+			}
+			else RunEvaluation(Path, C2, Flags, FlagsStack, Thread);
+			Path.Pop();
 		}
 	}
 
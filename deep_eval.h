@@ -26,8 +26,12 @@
 #include <array>
 #include <mutex>
 #include <thread>
+#include <atomic>
 
 #include "cube.h"
+#include "scheduler.h"
+#include "budget.h"
+#include "search_stats.h"
 
 namespace grcube3
 {
@@ -35,13 +39,21 @@ namespace grcube3
 	struct GroupCheck
 	{
         S64 EMask, CMask; // Masks for check the solve condition in edges and corners
-		std::vector<Pcp> Orient; // List of positions to be oriented
+		S64 OrientEMask, OrientCMask; // Direction masks for the positions to be oriented
 		Spn Spin; // Spin to evaluate the orientation
 
 		GroupCheck() { Clear(); }
 
 		// Clear masks
-		void Clear() { EMask = CMask = 0ull; Orient.clear(); Spin = Spn::Default; }
+		void Clear() { EMask = CMask = OrientEMask = OrientCMask = 0ull; Spin = Spn::Default; }
+	};
+
+	// Pending evaluation branch, to be run by any of the evaluation threads
+	struct EvalTask
+	{
+		SearchPath Path; // Branch algorithm
+		Cube C; // Cube with the scramble and the branch algorithm applied
+		std::vector<bool> Flags; // Solve flags from the upper level of the branch
 	};
 
     // Class to do an evaluation
@@ -56,8 +68,17 @@ namespace grcube3
 		uint GetCoresUsed() const { return UsedCores; } // Get system cores used in the last evaluation
 		uint GetBranches() const { return RootBranches; } // Get number of root branches in the evaluation
 		uint GetMaxDepth() const { return MaxDepth; } // Get the maximum depth in the evaluation
+		const std::vector<double>& GetThreadsBusyTime() const { return ThreadsBusyTime; } // Get the time each thread was evaluating in the last evaluation
+		const std::vector<double>& GetThreadsIdleTime() const { return ThreadsIdleTime; } // Get the time each thread was waiting for work in the last evaluation
 		
         void Run(const int = 0); // Run the evaluation; -1: use no threads, 0: use all threads avaliable, other: use specified number of threads
+
+		void SetBudget(SearchBudget* B) { Budget = B; } // Limits for the next evaluations (nullptr for no limits)
+		bool IsTruncated() const { return StopRequested.load(std::memory_order_relaxed); } // The last evaluation was stopped by the budget
+
+		// Statistics for the evaluations since the last reset (only with GRCUBE3_SEARCH_STATS defined), levels are algorithm sizes
+		const SearchStats& GetStats() const { return Stats; }
+		void ResetStats() { Stats.Reset(); }
 		
 		// Get the real number of cores used (a evaluation should be done)
         int GetRealCores(const int RequestedCores) const { return RequestedCores < 0 ? -1 : RequestedCores <= Cores ? RequestedCores : Cores; }
@@ -107,6 +128,15 @@ namespace grcube3
 
 		std::mutex SearchMutex; // Mutex for multithreading
 
+		WorkStealingScheduler<EvalTask>* Scheduler; // Scheduler for the running evaluation (nullptr if no evaluation is running)
+		std::vector<double> ThreadsBusyTime, ThreadsIdleTime; // Busy and idle time for each thread in the last evaluation (seconds)
+
+		SearchBudget* Budget; // Limits for the evaluations (nullptr if no limits)
+		std::vector<NodesCounter> ThreadNodes; // Nodes evaluated by each thread and not added to the budget yet
+		std::atomic<bool> StopRequested; // Budget exhausted, stop the running evaluation
+
+		SearchStats Stats; // Evaluation statistics
+
 		void UpdateRootData(); // Updates root algorithms
 
         // Reset groups of pieces positions to evaluate (solved and oriented)
@@ -122,13 +152,11 @@ namespace grcube3
         // Add a group of positions to be solved and/or oriented
         void AddToGroups(const std::vector<Pcp>&, const std::vector<Pcp>&, const Spn, const std::string = "");
 		
-		void RunThread(const uint); // Divide root evaluation branches into threads
-
-        void RunEvaluation(const Algorithm&, const std::vector<bool>&); // Run a evaluation branch
+        void RunEvaluation(SearchPath&, const Cube&, const std::vector<bool>&, std::vector<std::vector<bool>>&, const uint); // Run a evaluation branch
 		
-        void CheckAlg(const Algorithm&, std::vector<bool>&); // Check if an algorithm solve or orient the pieces
+        void CheckAlg(const uint, const Cube&, std::vector<bool>&, const uint); // Check if an algorithm (depth, cube with the algorithm applied) solve or orient the pieces
 		
-        void NextLevel(const Algorithm&, const std::vector<bool>&); // Prepare the branches for the next level of the evaluation
+        void NextLevel(SearchPath&, const Cube&, const std::vector<bool>&, std::vector<std::vector<bool>>&, const uint); // Prepare the branches for the next level of the evaluation
 	};
 }
 
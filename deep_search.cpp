@@ -22,8 +22,11 @@
 
 #include <thread>
 #include <mutex>
+#include <chrono>
+#include <algorithm>
 
 #include "deep_search.h"
+#include "symmetry.h"
 
 namespace grcube3
 {
@@ -33,9 +36,19 @@ namespace grcube3
     DeepSearch::DeepSearch(const Algorithm& scr, const Plc Pol) // Scramble to start the search
 	{	
         MaxDepth = MinDepth = 0u;
+        SolveFound = false;
+        StopRequested = false;
+        TopK = 0u; // All solves are stored by default
+        Budget = nullptr; // No limits by default
         SearchPolicy = Pol;
 		UsedCores = 0; // Not used cores yet
 		RootBranches = 0u;
+		Scheduler = nullptr; // No search running
+		Pruning = PruningActive = false; // No pruning tables by default
+		MeetInTheMiddle = MeetActive = false; // Regular search by default
+		MeetDepth = ForwardDepth = 0u;
+		MeetRuns = nullptr;
+		StepTurns = 0u;
         SetScramble(scr); // Apply the scramble
 	}
 
@@ -88,8 +101,28 @@ namespace grcube3
         OptionalSolvedMasks.push_back(MasksPair(Cube::GetMaskSolvedEdges(AuxEdgesList), Cube::GetMaskSolvedCorners(AuxCornersList)));
 	}
 
+	// Add a pieces group (positions for the default spin) as optional solved pieces for each of the given spins
+	void DeepSearch::AddToOptionalPieces(const Pgr OptionalPG, const std::vector<Spn>& Spins)
+	{
+		AddToOptionalPieces(OptionalPG); // Group for the default spin
+		const MasksPair DefaultMasks = OptionalSolvedMasks.back();
+		OptionalSolvedMasks.pop_back();
+
+		for (const auto sp : Spins) // The group for each spin is the default group conjugated with the spin symmetry
+		{
+			MasksPair SpinMasks = DefaultMasks;
+			Symmetry::ConjugateMasks(Symmetry::GetIndex(sp), SpinMasks.MaskE, SpinMasks.MaskC);
+			OptionalSolvedMasks.push_back(SpinMasks);
+		}
+	}
+
 	// Add a piece as mandatory solved piece positions for orientation
-    void DeepSearch::AddToMandatoryOrientations(const Pcp P) { MandatoryOrientedPos.push_back(P); }
+    void DeepSearch::AddToMandatoryOrientations(const Pcp P)
+	{
+		// Separate pieces in edges and corners
+		if (Cube::IsEdge(P)) MandatoryOrientedMasks.MaskE |= Cube::GetMaskEdgeDirection(Cube::PcpToEdp(P));
+		else if (Cube::IsCorner(P)) MandatoryOrientedMasks.MaskC |= Cube::GetMaskCornerDirection(Cube::PcpToCnp(P));
+	}
 
 	// Add a pieces group as mandatory orientated pieces positions
 	void DeepSearch::AddToMandatoryOrientations(const Pgr PG)
@@ -142,16 +175,14 @@ namespace grcube3
             case SequenceTypes::DOUBLE:
                 for (const auto S1 : U.MainSteps)
 				{
+					SearchPath R;
+					R.Push(S1);
                     for (const auto S2 : U.MainSteps)
 					{
-						Algorithm R;
-						R.Append(S1);
-						R.AppendShrink(S2);
-						if (R.GetSize() == 2u)
-						{
-							if (Algorithm::OppositeSteps(R[0], R[1]) && R[0] > R[1]) continue; // "D U" is the same than "U D"
-							Roots.push_back(R);
-						}
+						if (!R.IsCanonical(S2, *U.MainRuns)) continue; // "D U" is the same than "U D", "U U" is "U2"...
+						R.Push(S2);
+						Roots.push_back(R.GetAlgorithm());
+						R.Pop();
 					}
 				}
 				break;
@@ -159,21 +190,20 @@ namespace grcube3
             case SequenceTypes::TRIPLE:
                 for (const auto S1 : U.MainSteps)
 				{
+					SearchPath R;
+					R.Push(S1);
                     for (const auto S2 : U.MainSteps)
 					{
+						if (!R.IsCanonical(S2, *U.MainRuns)) continue;
+						R.Push(S2);
                         for (const auto S3 : U.MainSteps)
 						{
-							Algorithm R;
-							R.Append(S1);
-							R.AppendShrink(S2);
-							R.AppendShrink(S3);
-							if (R.GetSize() == 3u)
-							{
-								if ((Algorithm::OppositeSteps(R[0], R[1]) && R[0] > R[1]) ||
-									(Algorithm::OppositeSteps(R[1], R[2]) && R[1] > R[2])) continue; // "D U F" is the same than "U D F" 
-								Roots.push_back(R);
-							}
+							if (!R.IsCanonical(S3, *U.MainRuns)) continue; // "D U F" is the same than "U D F", "U D U" is "U2 D"...
+							R.Push(S3);
+							Roots.push_back(R.GetAlgorithm());
+							R.Pop();
 						}
+						R.Pop();
 					}
 				}
 				break;
@@ -183,6 +213,7 @@ namespace grcube3
 				{
                     for (const auto S : U.MainSteps)
 					{
+						if (CanonicalSequences::SameAxis(aS, S)) continue; // The conjugate would be the main step
 						Algorithm R;
 						R.Append(aS);
 						R.Append(S);
@@ -213,48 +244,409 @@ namespace grcube3
 			default: return false;
 			}
 		}
+		// The longest possible branch must fit in the search path
+		uint MaxPathSize = 0u;
+		for (const auto& R : Roots) if (R.GetSize() > MaxPathSize) MaxPathSize = R.GetSize();
+		for (uint l = 1u; l < Levels.size(); l++) MaxPathSize += Levels[l].GetMaxSteps();
+		if (MaxPathSize > SearchPath::MaxSize) Roots.clear();
+
 		RootBranches = static_cast<uint>(Roots.size());
+
+		UpdatePruningData();
+
 		return RootBranches > 0u;
 	}
+
+	// Prepare the pruning tables for the search
+	void DeepSearch::UpdatePruningData()
+	{
+		PruningActive = false;
+		MandatoryBound.Clear();
+		OptionalBounds.clear();
+		LevelsSteps.clear();
+		if (!Pruning || RootBranches == 0u) return;
+
+		// Maximum number of face turns for a step (the search steps could be not only face turns)
+		StepTurns = 0u;
+		for (const auto& L : Levels)
+		{
+			for (const auto& U : L.Units)
+			{
+				std::vector<Stp> Steps = U.MainSteps;
+				Steps.insert(Steps.end(), U.AuxSteps.begin(), U.AuxSteps.end());
+				for (const auto& A : U.MainAlgs) for (uint n = 0u; n < A.GetSize(); n++) Steps.push_back(A.At(n));
+
+				for (const auto S : Steps)
+				{
+					const int Turns = PruningTable::GetStepTurns(S);
+					if (Turns < 0) return; // Steps with unknown number of turns, no pruning
+					if (static_cast<uint>(Turns) > StepTurns) StepTurns = static_cast<uint>(Turns);
+				}
+			}
+		}
+
+		MandatoryBound.Set(MandatorySolvedMasks.MaskE, MandatorySolvedMasks.MaskC);
+		for (const auto& O : OptionalSolvedMasks)
+		{
+			OptionalBounds.push_back(PruningBound(O.MaskE, O.MaskC));
+			if (OptionalBounds.back().Empty()) { OptionalBounds.clear(); break; } // An optional pieces group without bound, optional pieces can't be used
+		}
+		if (MandatoryBound.Empty() && OptionalBounds.empty()) return; // Nothing to prune
+
+		LevelsSteps.assign(Levels.size() + 1u, 0u);
+		for (uint l = static_cast<uint>(Levels.size()); l-- > 0u;) LevelsSteps[l] = LevelsSteps[l + 1u] + Levels[l].GetMaxSteps();
+
+		PruningActive = true;
+	}
+
+	// Check if the pieces can't be solved with the steps from the given level to the last level (lower bound from the pruning tables)
+	inline bool DeepSearch::IsPruned(const Cube& C, const uint D, const uint Thread)
+	{
+		if (!PruningActive) return false;
+
+		const uint MD = MaxDepth.load(std::memory_order_relaxed);
+		const uint LastLevel = MD < Levels.size() ? MD : static_cast<uint>(Levels.size());
+		if (D >= LastLevel) return false;
+		const uint MaxTurns = (LevelsSteps[D] - LevelsSteps[LastLevel]) * StepTurns;
+
+		PiecesState PS;
+		PruningTable::GetPiecesState(C, PS);
+
+		if (!IsPruned(PS, MaxTurns)) return false;
+		Stats.Count(Thread, D, Sts::CUTOFFS);
+		return true;
+	}
+
+	// Check if the pieces can't be solved with the given number of face turns
+	bool DeepSearch::IsPruned(const PiecesState& PS, const uint MaxTurns) const
+	{
+		if (MandatoryBound.GetBound(PS) > MaxTurns) return true;
+		if (OptionalBounds.empty()) return false;
+		for (const auto& B : OptionalBounds) if (B.GetBound(PS) <= MaxTurns) return false; // Some optional group can be solved
+		return true;
+	}
+
+	// Set the group of pieces from the masks (only pieces with position and direction in the masks)
+	bool MeetTable::SetPieces(const S64 EMask, const S64 CMask)
+	{
+		Pieces.clear();
+		SolvedKey = 0u;
+		Entries.clear();
+		Index.clear();
+		Sequences.clear();
+
+		PiecesState Solved;
+		PruningTable::GetPiecesState(Cube(), Solved);
+
+		for (uint p = 0u; p < 20u; p++)
+		{
+			const S64 Mask = p < 12u ? EMask : CMask;
+			const S64 PieceMask = p < 12u ? Cube::GetMaskSolvedEdge(static_cast<Edp>(p)) : Cube::GetMaskSolvedCorner(static_cast<Cnp>(p - 12u));
+			if ((Mask & PieceMask) == 0u) continue; // Piece not in the group
+			if ((Mask & PieceMask) != PieceMask) return false; // Only position or only direction, the solved state is not unique
+			Pieces.push_back(p);
+		}
+		if (Pieces.empty() || Pieces.size() > MaxPieces) return false;
+
+		SolvedKey = GetKey(Solved);
+		return true;
+	}
+
+	// Index the added sequences: sequences are sorted by key and each key points to his first sequence
+	void MeetTable::Build()
+	{
+		std::sort(Entries.begin(), Entries.end());
+
+		Index.clear();
+		Sequences.clear();
+		Sequences.reserve(Entries.size());
+		for (const auto& E : Entries)
+		{
+			auto& I = Index[E.first];
+			if (I.second == 0u) I.first = static_cast<uint>(Sequences.size());
+			I.second++;
+			Sequences.push_back(E.second);
+		}
+		Entries.clear();
+		Entries.shrink_to_fit();
+	}
+
+	// Prepare the meet-in-the-middle tables for the current search, returns false if the search can't use them
+	bool DeepSearch::UpdateMeetData()
+	{
+		MeetTables.clear();
+
+		// The joined branches must be exactly the branches of a regular search, and all of them must be searched
+		if (SearchPolicy != Plc::BEST || MinDepth > 0u || MandatoryOrientedMasks.MaskE != 0ull || MandatoryOrientedMasks.MaskC != 0ull || Levels.empty()) return false;
+
+		// Same face turns for all the steps, each level adds a fixed number of steps
+		MeetSteps.clear();
+		LengthLevels.assign(1u, 0u);
+		LengthChecks.assign(1u, false);
+		for (uint l = 0u; l < Levels.size(); l++)
+		{
+			if (Levels[l].NumUnits() != 1u) return false;
+			const SearchUnit& U = Levels[l].Units[0];
+			if (U.Type != SequenceTypes::SINGLE && U.Type != SequenceTypes::DOUBLE && U.Type != SequenceTypes::TRIPLE) return false;
+			if (l == 0u) MeetSteps = U.MainSteps;
+			else if (U.MainSteps != MeetSteps) return false;
+
+			const uint n = U.GetMaxSteps();
+			for (uint s = 1u; s <= n; s++)
+			{
+				LengthLevels.push_back(l);
+				LengthChecks.push_back(s == n && Levels[l].Check == SearchCheck::CHECK);
+			}
+		}
+		if (MeetSteps.empty()) return false;
+		MeetRuns = &CanonicalSequences::Get(MeetSteps);
+		for (const auto S : MeetSteps) if (Algorithm::GetRange(S) != Rng::SINGLE) return false;
+
+		const uint MaxLength = static_cast<uint>(LengthChecks.size()) - 1u;
+		MeetDepth = MaxLength / 2u; // The forward half is the longer one when the depth is odd
+		ForwardDepth = MaxLength - MeetDepth;
+		if (MeetDepth == 0u || 5u * MeetDepth > 64u) return false;
+
+		// A table for each pieces group: mandatory pieces alone, or mandatory pieces with each optional group
+		std::vector<MasksPair> Groups;
+		if (OptionalSolvedMasks.empty()) Groups.push_back(MandatorySolvedMasks);
+		else for (const auto& O : OptionalSolvedMasks)
+			Groups.push_back(MasksPair(MandatorySolvedMasks.MaskE | O.MaskE, MandatorySolvedMasks.MaskC | O.MaskC));
+
+		MeetTables.resize(Groups.size());
+		for (uint g = 0u; g < Groups.size(); g++)
+		{
+			if (!MeetTables[g].SetPieces(Groups[g].MaskE, Groups[g].MaskC)) { MeetTables.clear(); return false; }
+		}
+
+		// Face turns don't change the spin, so the sequences are applied to a solved cube with the scramble spin
+		Cube Solved;
+		Solved.SetSpin(CubeBase.GetSpin());
+		SearchPath Path;
+		AddMeetSequences(Path, Solved);
+		for (auto& T : MeetTables) T.Build();
+
+		return true;
+	}
+
+	// Add all the canonical sequences with the tables length, each one from the pieces state it solves
+	void DeepSearch::AddMeetSequences(SearchPath& Path, const Cube& Solved)
+	{
+		if (Path.GetSize() == MeetDepth)
+		{
+			Cube C = Solved; // The sequence solves the pieces from the state of the solved cube with the inverted sequence
+			uint64_t Sequence = 0u;
+			for (uint n = MeetDepth; n-- > 0u;)
+			{
+				C.ApplyStep(Algorithm::InvertedStep(Path[n]));
+				Sequence = (Sequence << 5) | static_cast<uint64_t>(Path[n]); // First step in the lower bits
+			}
+
+			PiecesState PS;
+			PruningTable::GetPiecesState(C, PS);
+			for (auto& T : MeetTables) T.Add(T.GetKey(PS), Sequence);
+			return;
+		}
+
+		for (const auto S : MeetSteps)
+		{
+			if (!Path.IsCanonical(S, *MeetRuns)) continue;
+			Path.Push(S);
+			AddMeetSequences(Path, Solved); // Recursive
+			Path.Pop();
+		}
+	}
+
+	// Forward half of a meet-in-the-middle search: each branch is joined with the tables sequences
+	void DeepSearch::RunMeet(SearchPath& Path, const Cube& C, const uint Thread)
+	{
+		if (Budget != nullptr && !Budget->Count(ThreadNodes[Thread])) Stop(); // Out of budget
+		if (StopRequested.load(std::memory_order_relaxed)) return;
+
+		const uint Length = Path.GetSize();
+		Stats.Count(Thread, LengthLevels[Length], Sts::NODES);
+
+		PiecesState PS;
+		PruningTable::GetPiecesState(C, PS);
+
+		CheckMeet(Path, C, PS, Thread);
+
+		if (Length >= ForwardDepth) return;
+
+		if (PruningActive && IsPruned(PS, static_cast<uint>(LengthChecks.size()) - 1u - Length)) // Face turns, one turn per step
+		{
+			Stats.Count(Thread, LengthLevels[Length], Sts::CUTOFFS);
+			return;
+		}
+
+		for (const auto S : MeetSteps)
+		{
+			if (!Path.IsCanonical(S, *MeetRuns)) continue;
+			Cube C2 = C;
+			C2.ApplyStep(S);
+			Path.Push(S);
+			if (Scheduler != nullptr && Length + 3u < ForwardDepth && Scheduler->IsHungry()) // Give the branch to an idle thread
+			{
+				SearchTask T;
+				T.Path = Path;
+				T.CubeAlg = C2;
+				T.Depth = T.SeqId = T.SeqSize = 0u;
+				Scheduler->Push(Thread, T);
+			}
+			else RunMeet(Path, C2, Thread); // Recursive
+			Path.Pop();
+		}
+	}
+
+	// Join a forward branch with the tables: solves longer than the tables sequences have a full sequence in the backward half,
+	// shorter solves are checked directly in the forward half (each solve is found only once)
+	inline void DeepSearch::CheckMeet(SearchPath& Path, const Cube& C, const PiecesState& PS, const uint Thread)
+	{
+		const uint Length = Path.GetSize();
+		const bool CheckForward = Length < MeetDepth && LengthChecks[Length];
+		const bool CheckTables = LengthChecks[Length + MeetDepth];
+		if (!CheckForward && !CheckTables) return;
+
+		for (uint g = 0u; g < MeetTables.size(); g++)
+		{
+			const MeetTable& T = MeetTables[g];
+			const uint64_t Key = T.GetKey(PS);
+
+			if (CheckForward && T.IsSolved(Key))
+			{
+				bool Found = false; // The solve was added yet for a previous optional group
+				for (uint p = 0u; p < g && !Found; p++) Found = MeetTables[p].IsSolved(MeetTables[p].GetKey(PS));
+				if (!Found) AddSolve(Path, Thread, LengthLevels[Length]);
+			}
+
+			if (!CheckTables) continue;
+			Stats.Count(Thread, LengthLevels[Length + MeetDepth], Sts::CHECKS);
+
+			const uint64_t* Sequence = nullptr;
+			const uint n = T.Find(Key, Sequence);
+			for (uint i = 0u; i < n; i++)
+			{
+				Stats.Count(Thread, LengthLevels[Length + MeetDepth], Sts::MASK_HITS);
+
+				uint64_t Seq = Sequence[i];
+				uint Pushed = 0u;
+				for (; Pushed < MeetDepth; Pushed++, Seq >>= 5)
+				{
+					const Stp S = static_cast<Stp>(Seq & 0x1Fu);
+					if (!Path.IsCanonical(S, *MeetRuns)) break; // Sequences with the same effect are joined from other branches
+					Path.Push(S);
+				}
+
+				if (Pushed == MeetDepth)
+				{
+					bool Found = false; // The solve was added yet for a previous optional group
+					if (g > 0u)
+					{
+						Cube CheckCube = C;
+						for (uint s = Length; s < Path.GetSize(); s++) CheckCube.ApplyStep(Path[s]);
+						PiecesState CheckPS;
+						PruningTable::GetPiecesState(CheckCube, CheckPS);
+						for (uint p = 0u; p < g && !Found; p++) Found = MeetTables[p].IsSolved(MeetTables[p].GetKey(CheckPS));
+					}
+					if (!Found) AddSolve(Path, Thread, LengthLevels[Length + MeetDepth]);
+				}
+				Path.Pop(Pushed);
+			}
+		}
+	}
 	
 	// Run the search -> -1: use no threads, 0: use all threads avaliable, other: use specified number of threads
 	void DeepSearch::Run(const int UseThreads)
 	{
+		const auto time_search_start = std::chrono::steady_clock::now();
+
+		StopRequested = false;
+
 		if (RootBranches == 0u) return;
+
+		if (Budget != nullptr && !Budget->Spend(0u)) { Stop(); return; } // Budget exhausted by previous searches
 		
-		if (UseThreads >= 0) // Multithreading
+		if (UseThreads >= 0) UsedCores = (UseThreads == 0) || (UseThreads >= GetSystemCores()) ? GetSystemCores() : UseThreads; // Multithreading
+		else UsedCores = 1u; // Without multithreading (for debugging, slower)
+
+		// Roots are distributed among the threads queues, each thread takes the newest task from his own queue, so roots
+		// are queued in reverse order (the search order is the same as the roots order when no threads are used)
+		WorkStealingScheduler<SearchTask> WS(UsedCores);
+		SearchTask RootTask;
+		RootTask.Depth = RootTask.SeqId = RootTask.SeqSize = 0u;
+		MeetActive = MeetInTheMiddle && UpdateMeetData();
+		if (MeetActive) // A single root with the scramble, the forward search is split among the threads when they are hungry
 		{
-            UsedCores = (UseThreads == 0) || (UseThreads >= GetSystemCores()) ? GetSystemCores() : UseThreads;
-
-			std::vector<std::thread> Pool; // Threads pool
-
-			for (uint nc = 0; nc < UsedCores; nc++) Pool.push_back(std::thread(&DeepSearch::RunThread, this, nc)); // Add a thread per core
-            for (auto& t : Pool) t.join(); // Wait for all threads
+			RootTask.Path.Clear();
+			RootTask.CubeAlg = CubeBase;
+			WS.Push(0u, RootTask);
 		}
-        else // Without multithreading (for debugging, slower)
+		else for (uint n = RootBranches; n-- > 0u;)
 		{
-            for (const auto& R : Roots) RunSearch(R, 0u, 0u, 0u);
-			UsedCores = -1;
+			RootTask.Path.Clear();
+			RootTask.Path.Push(Roots[n]);
+			RootTask.CubeAlg = CubeBase; // The root algorithm is applied only once, deeper levels apply only the new steps
+			RootTask.CubeAlg.ApplyAlgorithm(Roots[n]);
+			WS.Push(n % UsedCores, RootTask);
 		}
+
+		ThreadSolves.assign(UsedCores, std::vector<Algorithm>()); // Each thread stores his solves without locks
+		ThreadTopSolves.assign(UsedCores, std::vector<std::pair<uint, Algorithm>>());
+		ThreadNodes.assign(UsedCores, NodesCounter());
+		Stats.Prepare(UsedCores, static_cast<uint>(Levels.size()));
+		SolveFound = !Solves.empty();
+
+		Scheduler = &WS;
+		if (MeetActive) WS.Run([this](const uint Thread, SearchTask& T) { RunMeet(T.Path, T.CubeAlg, Thread); }, UseThreads >= 0);
+		else WS.Run([this](const uint Thread, SearchTask& T) { RunSearch(T.Path, T.CubeAlg, Thread, T.Depth, T.SeqId, T.SeqSize); }, UseThreads >= 0);
+		Scheduler = nullptr;
+
+		if (Budget != nullptr) for (auto& TN : ThreadNodes) Budget->Flush(TN);
+
+		MergeSolves();
+
+		ThreadsBusyTime = WS.GetBusyTimes();
+		ThreadsIdleTime = WS.GetIdleTimes();
+		Stats.AddTimes(ThreadsBusyTime, std::chrono::duration<double>(std::chrono::steady_clock::now() - time_search_start).count());
+
+		if (UseThreads < 0) UsedCores = -1;
 	}
 	
-    // Run search a thread
-    void DeepSearch::RunThread(const uint NCore) { for (uint n = NCore; n < RootBranches; n += UsedCores) RunSearch(Roots[n], 0u, 0u, 0u); }
+	// Run a new search branch in the current thread or, if any thread is waiting for work and the branch is big enough, queue it
+	inline void DeepSearch::Branch(SearchPath& Path, const Cube& C, const uint Thread, const uint Depth, const uint SeqId, const uint SeqSize)
+	{
+		if (Scheduler != nullptr && Depth + 2u < MaxDepth.load(std::memory_order_relaxed) && Scheduler->IsHungry())
+		{
+			SearchTask T;
+			T.Path = Path;
+			T.CubeAlg = C;
+			T.Depth = Depth;
+			T.SeqId = SeqId;
+			T.SeqSize = SeqSize;
+			Scheduler->Push(Thread, T);
+		}
+		else RunSearch(Path, C, Thread, Depth, SeqId, SeqSize); // Recursive
+	}
     
 	// Recursive search code
-    void DeepSearch::RunSearch(const Algorithm& Alg, // Current search algorithm
+    void DeepSearch::RunSearch(SearchPath& Path, // Current search algorithm (steps are pushed and popped while the branch is explored)
+							   const Cube& CubeAlg, // Cube with the scramble and the current search algorithm applied
+							   const uint Thread, // Thread running the search
 							   uint Depth, // Current search depth
                                const uint SeqId, // Current sequence identifier (0 means root sequence or not in a sequence)
                                uint SeqSize) // Current sequence size
 	{
+		if (Budget != nullptr && !Budget->Count(ThreadNodes[Thread])) Stop(); // Out of budget, all branches will finish in the next level
+		Stats.Count(Thread, Depth, Sts::NODES);
+
 		if (SeqId == 0u) // Root or not in a sequence
 		{
 			// Check if current algorithm solves the pieces
-			if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Alg);
+			if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Path, CubeAlg, Thread, Depth);
 			
-			if (IncCheckDepth(Depth)) return; // It's no necessary to continue the search
+			if (IncCheckDepth(Depth) || IsPruned(CubeAlg, Depth, Thread)) return; // It's no necessary to continue the search
 
-			NextLevel(Alg, Depth); // Prepare the branches for the next level of the search
+			NextLevel(Path, CubeAlg, Thread, Depth); // Prepare the branches for the next level of the search
 		}
 			
         else for (const auto& U : Levels[Depth].Units)
@@ -267,9 +659,9 @@ namespace grcube3
 
 					if (SeqSize >= 3u) // Check if sequence is completed
 					{
-						if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Alg); // Check if current algorithm solves the pieces
-						if (IncCheckDepth(Depth)) return; // It's no necessary to continue the search
-						NextLevel(Alg, Depth); // Go to next level
+						if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Path, CubeAlg, Thread, Depth); // Check if current algorithm solves the pieces
+						if (IncCheckDepth(Depth) || IsPruned(CubeAlg, Depth, Thread)) return; // It's no necessary to continue the search
+						NextLevel(Path, CubeAlg, Thread, Depth); // Go to next level
 					}
 					else // Sequence is not completed
 					{
@@ -277,15 +669,22 @@ namespace grcube3
 						{
                             for (const auto S : U.MainSteps)
 							{
-								Algorithm Alg2 = Alg;
-                                if (!Alg2.AppendShrink(S)) RunSearch(Alg2, Depth, SeqId, SeqSize); // Recursive
+                                if (!Path.IsCanonical(S, *U.MainRuns) || CanonicalSequences::SameAxis(Path.Last(), S)) continue; // "R L R'" is "L"
+								Cube Cube2 = CubeAlg;
+								Cube2.ApplyStep(S);
+								Path.Push(S);
+								RunSearch(Path, Cube2, Thread, Depth, SeqId, SeqSize); // Recursive
+								Path.Pop();
 							}
 						}
 						else // Sequence size == 3u -> Add the last step
 						{
-							Algorithm Alg2 = Alg;
-							Alg2.Append(Alg.PenultimateInverted());
-                            RunSearch(Alg2, Depth, SeqId, SeqSize); // Recursive
+							const Stp LastStep = Path.PenultimateInverted();
+							Cube Cube2 = CubeAlg;
+							Cube2.ApplyStep(LastStep);
+							Path.Push(LastStep);
+                            RunSearch(Path, Cube2, Thread, Depth, SeqId, SeqSize); // Recursive
+							Path.Pop();
 						}
 					}
 					break;
@@ -294,9 +693,9 @@ namespace grcube3
 
 					if (SeqSize >= 3u) // Check if sequence is completed
 					{
-						if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Alg); // Check if current algorithm solves the pieces
-						if (IncCheckDepth(Depth)) return; // It's no necessary to continue the search
-						NextLevel(Alg, Depth); // Go to next level
+						if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Path, CubeAlg, Thread, Depth); // Check if current algorithm solves the pieces
+						if (IncCheckDepth(Depth) || IsPruned(CubeAlg, Depth, Thread)) return; // It's no necessary to continue the search
+						NextLevel(Path, CubeAlg, Thread, Depth); // Go to next level
 					}
 					else // Sequence is not completed
 					{
@@ -304,16 +703,21 @@ namespace grcube3
 						{
                             for (const auto& MA : U.MainAlgs)
 							{
-								Algorithm Alg2 = Alg;
-                                Alg2.Append(MA);
-                                RunSearch(Alg2, Depth, SeqId, SeqSize); // Recursive
+								Cube Cube2 = CubeAlg;
+								Cube2.ApplyAlgorithm(MA);
+								Path.Push(MA);
+                                RunSearch(Path, Cube2, Thread, Depth, SeqId, SeqSize); // Recursive
+								Path.Pop(MA.GetSize());
 							}
 						}
 						else // Sequence size == 3u -> Add the last step
 						{
-							Algorithm Alg2 = Alg;
-							Alg2.Append(Alg.PenultimateInverted());
-                            RunSearch(Alg2, Depth, SeqId, SeqSize); // Recursive
+							const Stp LastStep = Path.PenultimateInverted();
+							Cube Cube2 = CubeAlg;
+							Cube2.ApplyStep(LastStep);
+							Path.Push(LastStep);
+                            RunSearch(Path, Cube2, Thread, Depth, SeqId, SeqSize); // Recursive
+							Path.Pop();
 						}
 					}
 					break;
@@ -321,54 +725,109 @@ namespace grcube3
 				default: // Not into a sequence
 					
 					// Check if current algorithm solves the pieces
-					if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Alg);
+					if (Levels[Depth].Check == SearchCheck::CHECK) CheckSolve(Path, CubeAlg, Thread, Depth);
 				
-					if (IncCheckDepth(Depth)) return; // It's no necessary to continue the search
+					if (IncCheckDepth(Depth) || IsPruned(CubeAlg, Depth, Thread)) return; // It's no necessary to continue the search
 
-					NextLevel(Alg, Depth); // Prepare the branches for the next level of the search
+					NextLevel(Path, CubeAlg, Thread, Depth); // Prepare the branches for the next level of the search
 					break;
 				}
 			}
 		}
     }
 	
-	// Check if an algorithm solves the pieces
-    inline void DeepSearch::CheckSolve(const Algorithm& A)
+	// Check if an algorithm solves the pieces (the cube must have the scramble and the algorithm already applied)
+    inline void DeepSearch::CheckSolve(const SearchPath& Path, const Cube& CubeTest, const uint Thread, const uint Depth)
 	{
-		Cube CubeTest = CubeBase;
-		CubeTest.ApplyAlgorithm(A);
-
+		Stats.Count(Thread, Depth, Sts::CHECKS);
         if (CubeTest.IsSolved(MandatorySolvedMasks.MaskE, MandatorySolvedMasks.MaskC) && // True if no mandatory pieces
-			CubeTest.CheckOrientation(MandatoryOrientedPos))
+			CubeTest.IsOriented(MandatoryOrientedMasks.MaskE, MandatoryOrientedMasks.MaskC))
 		{
-            if (OptionalSolvedMasks.empty()) // Solve algorithm found (only mandatory)
-			{
-				std::lock_guard<std::mutex> guard(SearchMutex); // Thread safe code
-                if (SearchPolicy == Plc::SHORT && A.GetSize() < MaxDepth) MaxDepth = A.GetSize() + 1u;
-				Solves.push_back(A); 
-			}
+			Stats.Count(Thread, Depth, Sts::MASK_HITS);
+            if (OptionalSolvedMasks.empty()) AddSolve(Path, Thread, Depth); // Solve algorithm found (only mandatory)
 			else // Check solve algorithm found (mandatory + at least an optional)
 			{
                 for (const auto& O : OptionalSolvedMasks)
 				{
 					if (CubeTest.IsSolved(O.MaskE, O.MaskC))
 					{ // Solve algorithm found
-						std::lock_guard<std::mutex> guard(SearchMutex); // Thread safe code
-                        if (SearchPolicy == Plc::SHORT && A.GetSize() < MaxDepth) MaxDepth = A.GetSize() + 1u;
-						Solves.push_back(A);  
+						AddSolve(Path, Thread, Depth);
                         break;
 					}
 				}
 			}
 		}
 	}
+
+	// Add a solve to the thread solves (no locks needed)
+	inline void DeepSearch::AddSolve(const SearchPath& Path, const uint Thread, const uint Depth)
+	{
+		if (StopRequested.load(std::memory_order_relaxed)) return; // Branches still running after a stop don't add solves
+		Stats.Count(Thread, Depth, Sts::SOLVES);
+
+		if (SearchPolicy == Plc::SHORT) // Reduce the maximum depth (other threads could have reduced it yet, it never grows)
+		{
+			uint MD = MaxDepth.load(std::memory_order_relaxed);
+			while (Path.GetSize() < MD && !MaxDepth.compare_exchange_weak(MD, Path.GetSize() + 1u, std::memory_order_relaxed));
+		}
+		SolveFound.store(true, std::memory_order_relaxed);
+
+		if (!Visitor && TopK == 0u) // Store all solves
+		{
+			ThreadSolves[Thread].push_back(Path.GetAlgorithm()); // The path is converted to an algorithm only when a solve is recorded
+			return;
+		}
+
+		const Algorithm Solve = Path.GetAlgorithm();
+		if (TopK > 0u) AddTopSolve(Solve, Thread);
+		if (Visitor && !Visitor(Solve, Thread)) Stop(); // The visitor has enough solves
+	}
+
+	// Add a solve to the best solves of the thread, the worst solve is in the front of the heap to be replaced
+	inline void DeepSearch::AddTopSolve(const Algorithm& Solve, const uint Thread)
+	{
+		const auto Better = [](const std::pair<uint, Algorithm>& a, const std::pair<uint, Algorithm>& b) { return a.first > b.first; };
+		const uint Score = Scorer ? Scorer(Solve) : GetDefaultScore(Solve);
+		auto& Top = ThreadTopSolves[Thread];
+
+		if (Top.size() < TopK)
+		{
+			Top.emplace_back(Score, Solve);
+			std::push_heap(Top.begin(), Top.end(), Better);
+		}
+		else if (Score > Top.front().first)
+		{
+			std::pop_heap(Top.begin(), Top.end(), Better);
+			Top.back() = std::make_pair(Score, Solve);
+			std::push_heap(Top.begin(), Top.end(), Better);
+		}
+	}
+
+	// Join the solves from all threads (in top-K mode only the K best solves are kept, sorted by score)
+	void DeepSearch::MergeSolves()
+	{
+		if (TopK == 0u) for (auto& TS : ThreadSolves) Solves.insert(Solves.end(), TS.begin(), TS.end());
+		else
+		{
+			std::vector<std::pair<uint, Algorithm>> Top;
+			for (const auto& S : Solves) Top.emplace_back(Scorer ? Scorer(S) : GetDefaultScore(S), S); // Solves from previous searches
+			for (auto& TS : ThreadTopSolves) Top.insert(Top.end(), TS.begin(), TS.end());
+
+			std::stable_sort(Top.begin(), Top.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+			if (Top.size() > TopK) Top.resize(TopK);
+
+			Solves.clear();
+			for (auto& T : Top) Solves.push_back(T.second);
+		}
+		ThreadSolves.clear();
+		ThreadTopSolves.clear();
+	}
 	
 	// Prepare the branches for the next level of the search
-    inline void DeepSearch::NextLevel(const Algorithm& A, const uint D)
+    inline void DeepSearch::NextLevel(SearchPath& Path, const Cube& C, const uint Thread, const uint D)
 	{
-		if (A.GetSize() == 0u || D >= MaxDepth) return;
+		if (Path.Empty() || D >= MaxDepth.load(std::memory_order_relaxed)) return;
 		
-		Stp LastStep = A.Last();
 		for (const auto& U : Levels[D].Units)
 		{
 			switch (U.Type)
@@ -376,26 +835,34 @@ namespace grcube3
             case SequenceTypes::SINGLE:
 				for (const auto S : U.MainSteps)
 				{
-					if (Algorithm::OppositeSteps(LastStep, S) && LastStep > S) continue; // As in an algorithm "... U D ..." branch is the same than "... D U ..." branch, compute only one.
-					Algorithm Alg2 = A; // Continue the search only on a longer algorithm (shorter or equal lenght means that will be calculated upper in the tree)
-					if (!Alg2.AppendShrink(S)) RunSearch(Alg2, D, U.Id); // Recursive
+					if (!Path.IsCanonical(S, *U.MainRuns)) continue; // Only a branch for the sequences with the same effect ("U D" and "D U", "U D U" and "U2 D"...)
+					Cube C2 = C; // Only the new step is applied to the cube
+					C2.ApplyStep(S);
+					Path.Push(S);
+					Branch(Path, C2, Thread, D, U.Id);
+					Path.Pop();
 				}
 				break;
             case SequenceTypes::SEQUENCE:
                 for (const auto& MA : U.MainAlgs)
 				{
-					Algorithm Alg2 = A;
-					Alg2.Append(MA);
-					RunSearch(Alg2, D); // Recursive
+					Cube C2 = C;
+					C2.ApplyAlgorithm(MA);
+					Path.Push(MA);
+					Branch(Path, C2, Thread, D);
+					Path.Pop(MA.GetSize());
 				}
 				break;
             case SequenceTypes::CONJUGATE_SINGLE:
             case SequenceTypes::CONJUGATE:
 				for (const auto S : U.AuxSteps)
 				{
-					if (Algorithm::OppositeSteps(LastStep, S) && LastStep > S) continue; // As in an algorithm "... U D ..." branch is the same than "... D U ..." branch, compute only one.
-					Algorithm Alg2 = A; // Continue the search only on a longer algorithm (shorter or equal lenght means that will be calculated upper in the tree)
-					if (!Alg2.AppendShrink(S)) RunSearch(Alg2, D, U.Id, 1u); // Recursive
+					if (!Path.IsCanonical(S, *U.AuxRuns)) continue; // Only a branch for the sequences with the same effect ("U D" and "D U", "U D U" and "U2 D"...)
+					Cube C2 = C; // Only the new step is applied to the cube
+					C2.ApplyStep(S);
+					Path.Push(S);
+					Branch(Path, C2, Thread, D, U.Id, 1u);
+					Path.Pop();
 				}
 				break;
 
@@ -547,6 +1014,7 @@ namespace grcube3
 		AddSearchLevel(L_Root); // Level 1 (two steps -DOUBLE- root algorithms)
 		for (uint l = 2u; l < depth; l++) AddSearchLevel(L_Check); // Levels 2 to given depth
 
+		SetMeetInTheMiddle(); // Join forward and backward halves of the search
 		UpdateRootData();
 
 		Run(cores);
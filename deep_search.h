@@ -25,8 +25,15 @@
 #include <vector>
 #include <mutex>
 #include <thread>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
 
 #include "cube.h"
+#include "scheduler.h"
+#include "pruning.h"
+#include "budget.h"
+#include "search_stats.h"
 
 namespace grcube3
 {
@@ -55,6 +62,8 @@ namespace grcube3
 		std::vector<Stp> MainSteps; // Steps allowed for the sequence main part
 		std::vector<Algorithm> MainAlgs; // Algorithms allowed for the sequence main part
 		std::vector<Stp> AuxSteps; // Auxiliary steps allowed for the conjugate (first and last step)	
+		const CanonicalSequences* MainRuns; // Canonical runs for the main steps
+		const CanonicalSequences* AuxRuns; // Canonical runs for the auxiliary steps
 
 		// Constructor with default parameters
 		SearchUnit(const SequenceTypes _Type, const Sst _MainSteps = Sst::SINGLE_ALL, const Sst _AuxSteps = Sst::NONE)
@@ -68,10 +77,31 @@ namespace grcube3
 			
 			if (Type == SequenceTypes::CONJUGATE_SINGLE || Type == SequenceTypes::CONJUGATE)
 				Algorithm::AddToStepsList(_AuxSteps, AuxSteps);
+
+			MainRuns = &CanonicalSequences::Get(MainSteps);
+			AuxRuns = &CanonicalSequences::Get(AuxSteps);
 		}
 		
         void AddAlgorithm(const Algorithm &A) { MainAlgs.push_back(A); }
 		void ClearAlgorithms() { MainAlgs.clear(); }
+
+		// Get the maximum number of steps this unit can add to a search branch
+		uint GetMaxSteps() const
+		{
+			uint MaxAlg = 0u;
+			for (const auto& A : MainAlgs) if (A.GetSize() > MaxAlg) MaxAlg = A.GetSize();
+
+			switch (Type)
+			{
+			case SequenceTypes::SINGLE: return 1u;
+			case SequenceTypes::DOUBLE: return 2u;
+			case SequenceTypes::TRIPLE:
+			case SequenceTypes::CONJUGATE_SINGLE: return 3u;
+			case SequenceTypes::SEQUENCE: return MaxAlg;
+			case SequenceTypes::CONJUGATE: return MaxAlg + 2u;
+			default: return 0u;
+			}
+		}
 	};
 
 	// Search level data (each search level can have several search units)
@@ -89,6 +119,14 @@ namespace grcube3
         void Add(const SearchUnit& SU) { Units.push_back(SU); } // Add a unit to the level
 		void Clear() { Units.clear(); } // Clear level
 		uint NumUnits() const { return static_cast<uint>(Units.size()); } // Get number of search units in this level
+
+		// Get the maximum number of steps this level can add to a search branch
+		uint GetMaxSteps() const
+		{
+			uint MaxSteps = 0u;
+			for (const auto& U : Units) if (U.GetMaxSteps() > MaxSteps) MaxSteps = U.GetMaxSteps();
+			return MaxSteps;
+		}
 	};
 
     // Struct to store a pair of masks (edges and corners status masks)
@@ -103,6 +141,63 @@ namespace grcube3
 		void Clear() { MaskE = MaskC = 0ull; }
 	};
 
+	// Function called for each solve as soon as it is found, from the thread that found it (it must be thread safe).
+	// Parameters are the solve and the thread index. Returning false stops the search
+	typedef std::function<bool(const Algorithm&, const uint)> SolveVisitor;
+
+	// Function to score the solves for the top-K mode (higher is better)
+	typedef std::function<uint(const Algorithm&)> SolveScorer;
+
+	// Table for the meet-in-the-middle search: sequences of a fixed length that solve a group of pieces, indexed by the state
+	// of the pieces before the sequence (five bits for the position and direction of each piece in the group)
+	class MeetTable
+	{
+	public:
+		static constexpr uint MaxPieces = 12u; // Maximum number of pieces in a 64 bits key
+
+		// Set the group of pieces from the masks, returns false if some piece is only partially in the masks or the group is not valid
+		bool SetPieces(const S64, const S64);
+
+		// Get the key for the state of the group of pieces
+		uint64_t GetKey(const PiecesState& PS) const
+		{
+			uint64_t Key = 0u;
+			for (const auto p : Pieces) Key = (Key << 5) | PS[p];
+			return Key;
+		}
+
+		bool IsSolved(const uint64_t Key) const { return Key == SolvedKey; } // Check if the key is the solved state of the pieces
+
+		void Add(const uint64_t Key, const uint64_t Sequence) { Entries.push_back(std::make_pair(Key, Sequence)); } // Add a sequence (before Build)
+		void Build(); // Index the added sequences
+
+		// Get the sequences that solve the pieces from the given key, returns the number of sequences
+		uint Find(const uint64_t Key, const uint64_t*& First) const
+		{
+			const auto it = Index.find(Key);
+			if (it == Index.end()) return 0u;
+			First = Sequences.data() + it->second.first;
+			return it->second.second;
+		}
+
+	private:
+		std::vector<uint> Pieces; // Pieces in the group (edges 0 to 11, corners 12 to 19)
+		uint64_t SolvedKey; // Key for the solved pieces
+		std::vector<std::pair<uint64_t, uint64_t>> Entries; // Added sequences with their keys
+		std::unordered_map<uint64_t, std::pair<uint, uint>> Index; // First sequence and number of sequences for each key
+		std::vector<uint64_t> Sequences; // Sequences sorted by key (five bits per step)
+	};
+
+	// Pending search branch, to be run by any of the search threads
+	struct SearchTask
+	{
+		SearchPath Path; // Branch algorithm
+		Cube CubeAlg; // Cube with the scramble and the branch algorithm applied
+		uint Depth, // Branch search depth
+			 SeqId, // Branch sequence identifier (0 means root sequence or not in a sequence)
+			 SeqSize; // Branch sequence size
+	};
+
     // Class to do a multithread tree search
 	class DeepSearch
 	{
@@ -116,6 +211,13 @@ namespace grcube3
         void Clear() 
 		{ 
 			Solves.clear();
+			ThreadSolves.clear();
+			SolveFound = false;
+			StopRequested = false;
+			Visitor = nullptr;
+			TopK = 0u;
+			Scorer = nullptr;
+			ThreadTopSolves.clear();
 			ResetPieces();
 			MaxDepth = MinDepth = 0u;
 			Scramble.Clear();
@@ -123,24 +225,66 @@ namespace grcube3
 			SetBestPolicy();
 			UsedCores = 0u;
 			RootBranches = 0u;
+			Scheduler = nullptr;
+			Pruning = PruningActive = false;
+			MeetInTheMiddle = MeetActive = false;
+			MeetTables.clear();
+			ThreadsBusyTime.clear();
+			ThreadsIdleTime.clear();
 			Roots.clear();
 			Levels.clear();
 		}
 
 		std::vector<Algorithm>& GetSolves() { return Solves; }
 		
-        uint* GetMaxDepthPointer() { return &MaxDepth; }
-        bool CheckSkipSearch() { return MaxDepth == 0u && !Levels.empty(); }
+		// Pointer to the maximum depth, setting it to zero stops the search from any thread
+        std::atomic<uint>* GetMaxDepthPointer() { return &MaxDepth; }
+        bool CheckSkipSearch() const { return (MaxDepth.load(std::memory_order_relaxed) == 0u && !Levels.empty()) || (Budget != nullptr && Budget->IsExhausted()); }
 		   
 		uint GetUsedCores() const { return UsedCores; } // Get system cores used in the last search
 		uint GetBranches() const { return RootBranches; } // Get number of root branches in the search
-        uint GetMaxDepth() const { return MaxDepth; } // Get the maximum depth in the search
+		const std::vector<double>& GetThreadsBusyTime() const { return ThreadsBusyTime; } // Get the time each thread was searching in the last search
+		const std::vector<double>& GetThreadsIdleTime() const { return ThreadsIdleTime; } // Get the time each thread was waiting for work in the last search
+        uint GetMaxDepth() const { return MaxDepth.load(std::memory_order_relaxed); } // Get the maximum depth in the search
         uint GetMinDepth() const { return MinDepth; } // Get the minimum depth in the search
 		
 		void SetBestPolicy() { SearchPolicy = Plc::BEST; }
 		void SetShortPolicy() { SearchPolicy = Plc::SHORT; }
+
+		// Send each solve to the visitor as it is found, solves are not stored unless top-K mode is enabled (nullptr to store all solves again)
+		void SetSolveVisitor(const SolveVisitor& V) { Visitor = V; }
+
+		// Keep only the K best solves, sorted by score (0 to keep all the solves). Without scorer, the shorter solves are the best
+		void SetTopK(const uint K, const SolveScorer& S = nullptr) { TopK = K; Scorer = S; }
+
+		// Default score for the solves (shorter is better, the subjective score breaks ties)
+		static uint GetDefaultScore(const Algorithm& A) { return (1000u - A.GetSize()) * 100u - A.GetSubjectiveScore(); }
+
+		// Stop the running search from any thread (a visitor can also stop it returning false)
+		void Stop() { StopRequested.store(true, std::memory_order_relaxed); }
+		bool IsStopped() const { return StopRequested.load(std::memory_order_relaxed); } // The last search was stopped before completion
+
+		// Limits for the next searches (nullptr for no limits). The budget is kept after Clear, so all the searches for a scramble can share it
+		void SetBudget(SearchBudget* B) { Budget = B; }
+		SearchBudget* GetBudget() const { return Budget; }
+
+		// The solves from the last search are not complete (stopped, skipped or out of budget)
+		bool IsTruncated() const { return IsStopped() || CheckSkipSearch(); }
+
+		// Statistics for the searches since the last reset (only with GRCUBE3_SEARCH_STATS defined, they are kept after Clear)
+		const SearchStats& GetStats() const { return Stats; }
+		void ResetStats() { Stats.Reset(); }
+
+		// Search only half of the depth forward and join the branches with a table of the sequences that solve the pieces from the end
+		// (meet-in-the-middle). Only for exhaustive searches (best policy, no minimum depth) with the same face turns in all levels,
+		// single, double or triple units and solved pieces conditions; other searches use the regular search
+		void SetMeetInTheMiddle(const bool m = true) { MeetInTheMiddle = m; }
+		bool IsMeetInTheMiddle() const { return MeetActive; } // The last search used the meet-in-the-middle mode
+
+		// Use pruning tables to skip the branches that can't solve the pieces in the remaining levels (set before UpdateRootData)
+		void SetPruning(const bool p = true) { Pruning = p; }
 		
-        void SetMinDepth(const uint d) { MinDepth = d <= MaxDepth ? d : MaxDepth; }
+        void SetMinDepth(const uint d) { MinDepth = d <= GetMaxDepth() ? d : GetMaxDepth(); }
 		
         void Run(const int = 0); // Run the search; -1: use no threads, 0: use all threads avaliable, other: use specified number of threads
 
@@ -148,7 +292,8 @@ namespace grcube3
 		bool IncCheckDepth(uint& Depth)
 		{
 			Depth++;
-			return Depth >= MaxDepth || (MinDepth > 0u && !Solves.empty() && Depth >= MinDepth);
+			return Depth >= MaxDepth.load(std::memory_order_relaxed) || (MinDepth > 0u && Depth >= MinDepth && SolveFound.load(std::memory_order_relaxed)) ||
+				   StopRequested.load(std::memory_order_relaxed);
 		}
 
         // Returns the shorter algorithm from the solves (optionally priorize some steps)
@@ -169,6 +314,10 @@ namespace grcube3
 		// Add a pieces group as optional solved pieces
 		void AddToOptionalPieces(const Pgr);
 
+		// Add a pieces group (positions for the default spin) as optional solved pieces for each of the given spins
+		// All the spins are searched in a single traversal, each node is checked against the group of every spin
+		void AddToOptionalPieces(const Pgr, const std::vector<Spn>&);
+
         // Add a piece as mandatory piece in his position (orientation not needed)
         void AddToMandatoryPositions(const Pcp);
 
@@ -186,7 +335,7 @@ namespace grcube3
 		{ 
 			MandatorySolvedMasks.Clear();
 			OptionalSolvedMasks.clear();
-			MandatoryOrientedPos.clear();
+			MandatoryOrientedMasks.Clear();
 		}
 
 		// Add a search level
@@ -209,9 +358,25 @@ namespace grcube3
 	private:	
 
 		std::vector<Algorithm> Solves; // Algorithms that solve the search
+		std::vector<std::vector<Algorithm>> ThreadSolves; // Solves found by each thread in the running search (merged into Solves at the end)
+		std::atomic<bool> SolveFound; // At least a solve has been found
+		std::atomic<bool> StopRequested; // Stop the running search as soon as possible
+
+		SolveVisitor Visitor; // Function to send the solves as they are found (if empty, solves are stored)
+		uint TopK; // Maximum number of solves to store (0 means no limit)
+		SolveScorer Scorer; // Function to score the solves for the top-K mode (if empty, default score is used)
+		std::vector<std::vector<std::pair<uint, Algorithm>>> ThreadTopSolves; // Best solves found by each thread for the top-K mode (min-heaps by score)
+
+		SearchBudget* Budget; // Limits for the searches (nullptr if no limits)
+		std::vector<NodesCounter> ThreadNodes; // Nodes searched by each thread and not added to the budget yet
+
+		SearchStats Stats; // Search statistics
 		
-		uint MaxDepth, // Maximum depth for the search (levels)
-			 MinDepth; // Minimum depth for the search (if there is at least a solve in MinDepth search depth, stops current branch search)
+		// Maximum depth for the search (levels). It can be reduced by the search threads (short policy) and set to zero from
+		// other threads to stop the search. It's only a bound for the search, no other data depends on it, so all accesses
+		// use relaxed memory order
+		std::atomic<uint> MaxDepth;
+		uint MinDepth; // Minimum depth for the search (if there is at least a solve in MinDepth search depth, stops current branch search)
 			 
         Plc SearchPolicy; // Search policy (default best solves)
 		
@@ -225,16 +390,45 @@ namespace grcube3
 
         MasksPair MandatorySolvedMasks; // Masks for mandatory pieces to be solved
 		std::vector<MasksPair> OptionalSolvedMasks; // Masks pairs for optional pieces solved
-        std::vector<Pcp> MandatoryOrientedPos; // Mandatory pieces positions for orientation
+        MasksPair MandatoryOrientedMasks; // Direction masks for mandatory pieces positions for orientation
         
 		std::vector<SearchLevel> Levels; // Levels for search
 
-		std::mutex SearchMutex; // Mutex for multithreading
+
+		bool Pruning, // Pruning tables enabled
+			 PruningActive; // Pruning tables in use for the current search (not all searches can use them)
+		PruningBound MandatoryBound; // Lower bound for the mandatory pieces
+		std::vector<PruningBound> OptionalBounds; // Lower bounds for the optional pieces
+		std::vector<uint> LevelsSteps; // Maximum number of steps from each level to the last level
+		uint StepTurns; // Maximum number of face turns for a step in the search
+
+		bool MeetInTheMiddle, // Meet-in-the-middle search enabled
+			 MeetActive; // Meet-in-the-middle search in use for the current search
+		std::vector<MeetTable> MeetTables; // Tables for each group of pieces (mandatory pieces + each optional group)
+		std::vector<Stp> MeetSteps; // Steps for the meet-in-the-middle search
+		const CanonicalSequences* MeetRuns; // Canonical runs for the meet-in-the-middle steps
+		std::vector<uint> LengthLevels; // Search level for each algorithm length
+		std::vector<bool> LengthChecks; // Algorithms with each length must be checked
+		uint MeetDepth, // Length of the sequences in the tables (backward half)
+			 ForwardDepth; // Maximum length of the forward half
+
+		WorkStealingScheduler<SearchTask>* Scheduler; // Scheduler for the running search (nullptr if no search is running)
+		std::vector<double> ThreadsBusyTime, ThreadsIdleTime; // Busy and idle time for each thread in the last search (seconds)
 		
-		void RunThread(const uint); // Divide search branches into threads
-        void RunSearch(const Algorithm&, uint, const uint = 0u, uint = 0u); // Run a search branch
-        void CheckSolve(const Algorithm&); // Check if an algorithm solves the pieces
-        void NextLevel(const Algorithm&, const uint); // Prepare the branches for the next level of the search
+        void RunSearch(SearchPath&, const Cube&, uint, const uint, const uint = 0u, uint = 0u); // Run a search branch (the cube carries the current branch state)
+        void Branch(SearchPath&, const Cube&, const uint, const uint, const uint = 0u, const uint = 0u); // Run a new search branch or give it to an idle thread
+        void CheckSolve(const SearchPath&, const Cube&, const uint, const uint); // Check if an algorithm solves the pieces
+		void AddSolve(const SearchPath&, const uint, const uint); // Add a solve found by the given thread in the given level
+		void AddTopSolve(const Algorithm&, const uint); // Add a solve to the best solves of the given thread (top-K mode)
+		void MergeSolves(); // Join the solves from all threads into the solves vector
+        void NextLevel(SearchPath&, const Cube&, const uint, const uint); // Prepare the branches for the next level of the search
+		void UpdatePruningData(); // Prepare the pruning tables for the search
+		bool IsPruned(const Cube&, const uint, const uint); // Check if the pieces can't be solved from the given level
+		bool IsPruned(const PiecesState&, const uint) const; // Check if the pieces can't be solved with the given number of face turns
+		bool UpdateMeetData(); // Prepare the meet-in-the-middle tables, returns false if the search can't use them
+		void AddMeetSequences(SearchPath&, const Cube&); // Add the sequences to the meet-in-the-middle tables (recursive)
+		void RunMeet(SearchPath&, const Cube&, const uint); // Run the forward half of a meet-in-the-middle search
+		void CheckMeet(SearchPath&, const Cube&, const PiecesState&, const uint); // Join a forward branch with the tables
 	};
 }
 
@@ -98,37 +98,8 @@ namespace grcube3
 		{ Stc::DR_R, Stc::DR_D }, // DR
 	};
 
-    // Edge positions from spin and absolut edge positions
-    const Edp c_Edges::edp_Absolut[24][12] =
-    {
-        { Edp::FR, Edp::FL, Edp::BL, Edp::BR, Edp::UF, Edp::UL, Edp::UB, Edp::UR, Edp::DF, Edp::DL, Edp::DB, Edp::DR }, // UF
-        { Edp::BR, Edp::FR, Edp::FL, Edp::BL, Edp::UR, Edp::UF, Edp::UL, Edp::UB, Edp::DR, Edp::DF, Edp::DL, Edp::DB }, // UR
-        { Edp::BL, Edp::BR, Edp::FR, Edp::FL, Edp::UB, Edp::UR, Edp::UF, Edp::UL, Edp::DB, Edp::DR, Edp::DF, Edp::DL }, // UB
-        { Edp::FL, Edp::BL, Edp::BR, Edp::FR, Edp::UL, Edp::UB, Edp::UR, Edp::UF, Edp::DL, Edp::DB, Edp::DR, Edp::DF }, // UL
-        { Edp::FL, Edp::FR, Edp::BR, Edp::BL, Edp::DF, Edp::DR, Edp::DB, Edp::DL, Edp::UF, Edp::UR, Edp::UB, Edp::UL }, // DF
-        { Edp::FR, Edp::BR, Edp::BL, Edp::FL, Edp::DR, Edp::DB, Edp::DL, Edp::DF, Edp::UR, Edp::UB, Edp::UL, Edp::UF }, // DR
-        { Edp::BR, Edp::BL, Edp::FL, Edp::FR, Edp::DB, Edp::DL, Edp::DF, Edp::DR, Edp::UB, Edp::UL, Edp::UF, Edp::UR }, // DB
-        { Edp::BL, Edp::FL, Edp::FR, Edp::BR, Edp::DL, Edp::DF, Edp::DR, Edp::DB, Edp::UL, Edp::UF, Edp::UR, Edp::UB }, // DL
-        { Edp::UL, Edp::UR, Edp::DR, Edp::DL, Edp::UF, Edp::FR, Edp::DF, Edp::FL, Edp::UB, Edp::BR, Edp::DB, Edp::BL }, // FU
-        { Edp::UR, Edp::DR, Edp::DL, Edp::UL, Edp::FR, Edp::DF, Edp::FL, Edp::UF, Edp::BR, Edp::DB, Edp::BL, Edp::UB }, // FR
-        { Edp::DR, Edp::DL, Edp::UL, Edp::UR, Edp::DF, Edp::FL, Edp::UF, Edp::FR, Edp::DB, Edp::BL, Edp::UB, Edp::BR }, // FD
-        { Edp::DL, Edp::UL, Edp::UR, Edp::DR, Edp::FL, Edp::UF, Edp::FR, Edp::DF, Edp::BL, Edp::UB, Edp::BR, Edp::DB }, // FL
-        { Edp::UR, Edp::UL, Edp::DL, Edp::DR, Edp::UB, Edp::BL, Edp::DB, Edp::BR, Edp::UF, Edp::FL, Edp::DF, Edp::FR }, // BU
-        { Edp::DR, Edp::UR, Edp::UL, Edp::DL, Edp::BR, Edp::UB, Edp::BL, Edp::DB, Edp::FR, Edp::UF, Edp::FL, Edp::DF }, // BR
-        { Edp::DL, Edp::DR, Edp::UR, Edp::UL, Edp::DB, Edp::BR, Edp::UB, Edp::BL, Edp::DF, Edp::FR, Edp::UF, Edp::FL }, // BD
-        { Edp::UL, Edp::DL, Edp::DR, Edp::UR, Edp::BL, Edp::DB, Edp::BR, Edp::UB, Edp::FL, Edp::DF, Edp::FR, Edp::UF }, // BL
-        { Edp::UF, Edp::UB, Edp::DB, Edp::DF, Edp::UR, Edp::BR, Edp::DR, Edp::FR, Edp::UL, Edp::BL, Edp::DL, Edp::FL }, // RU
-        { Edp::DF, Edp::UF, Edp::UB, Edp::DB, Edp::FR, Edp::UR, Edp::BR, Edp::DR, Edp::FL, Edp::UL, Edp::BL, Edp::DL }, // RF
-        { Edp::DB, Edp::DF, Edp::UF, Edp::UB, Edp::DR, Edp::FR, Edp::UR, Edp::BR, Edp::DL, Edp::FL, Edp::UL, Edp::BL }, // RD
-        { Edp::UB, Edp::DB, Edp::DF, Edp::UF, Edp::BR, Edp::DR, Edp::FR, Edp::UR, Edp::BL, Edp::DL, Edp::FL, Edp::UL }, // RB
-        { Edp::UB, Edp::UF, Edp::DF, Edp::DB, Edp::UL, Edp::FL, Edp::DL, Edp::BL, Edp::UR, Edp::FR, Edp::DR, Edp::BR }, // LU
-        { Edp::UF, Edp::DF, Edp::DB, Edp::UB, Edp::FL, Edp::DL, Edp::BL, Edp::UL, Edp::FR, Edp::DR, Edp::BR, Edp::UR }, // LF
-        { Edp::DF, Edp::DB, Edp::UB, Edp::UF, Edp::DL, Edp::BL, Edp::UL, Edp::FL, Edp::DR, Edp::BR, Edp::UR, Edp::FR }, // LD
-        { Edp::DB, Edp::UB, Edp::UF, Edp::DF, Edp::BL, Edp::UL, Edp::FL, Edp::DL, Edp::BR, Edp::UR, Edp::FR, Edp::DR }  // LB
-    };
-	
 	// Absolute edge positions from spin and edge positions
-	const Aep c_Edges::aep_Positions[24][12] =
+	constexpr Aep c_Edges::aep_Positions[24][12] =
 	{
 		{ Aep::FR, Aep::FL, Aep::BL, Aep::BR, Aep::UF, Aep::UL, Aep::UB, Aep::UR, Aep::DF, Aep::DL, Aep::DB, Aep::DR }, // UF
 		{ Aep::FL, Aep::BL, Aep::BR, Aep::FR, Aep::UL, Aep::UB, Aep::UR, Aep::UF, Aep::DL, Aep::DB, Aep::DR, Aep::DF }, // UR
@@ -156,664 +127,123 @@ namespace grcube3
 		{ Aep::DB, Aep::UB, Aep::UF, Aep::DF, Aep::BL, Aep::UL, Aep::FL, Aep::DL, Aep::BR, Aep::UR, Aep::FR, Aep::DR }  // LB
 	};	
 
-	const Edd c_Edges::edd_OrientationPOS[24][12][12] = // Edges directions for positive orientation
-	{
-		// Spin UF
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin UR
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin UB
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin UL
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin DF
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin DR
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin DB
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin DL
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin FU
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin FR
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin FD
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin FL
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin BU
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin BR
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin BD
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin BL
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DR
-		},
-		// Spin RU
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin RF
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin RD
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin RB
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin LU
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin LF
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		},
-		// Spin LD
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // BR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // UR
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }, // DL
-			 { Edd::NEG, Edd::NEG, Edd::NEG, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS, Edd::NEG, Edd::POS }  // DR
-		},
-		// Spin LB
-		{ //      FR        FL        BL        BR        UF        UL        UB        UR        DF        DL        DB        DR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // FL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // BR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // UR
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DF
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DL
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }, // DB
-			 { Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS, Edd::POS }  // DR
-		}
+	// Edge positions from spin and absolut edge positions
+	constexpr FixedTable2<Edp, 24, 12> c_Edges::edp_Absolut = InverseTable<Edp>(aep_Positions);
+
+	// Positive orientation for each spin as bits operations (orientation group: none, U and D layers edges or M slice edges)
+	constexpr c_Edges::EdgesOrientation c_Edges::e_Orientation[24] =
+	{
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // UF
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // UR
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // UB
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // UL
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // DF
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // DR
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // DB
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // DL
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // FU
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // FR
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // FD
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // FL
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // BU
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // BR
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // BD
+		{ 0x0000111111111111ULL, 0x0000000000000000ULL, 0x0FF0000000000000ULL }, // BL
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // RU
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // RF
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // RD
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // RB
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // LU
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, // LF
+		{ 0x0000111111111111ULL, 0x0000111111111111ULL, 0x0550000000000000ULL }, // LD
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }  // LB
 	};
 
-	void c_Edges::e_U() // Movement U
-	{
-		S64 buffer = GetStatusPos_UF();
-		PutStatusPos_UF(GetStatusPos_UR());
-		PutStatusPos_UR(GetStatusPos_UB());
-		PutStatusPos_UB(GetStatusPos_UL());
-		PutStatusPos_UL(buffer);
-	
-		buffer = GetStatusDir_UF();
-		PutStatusDir_UF(GetStatusDir_UR());
-		PutStatusDir_UR(GetStatusDir_UB());
-		PutStatusDir_UB(GetStatusDir_UL());
-		PutStatusDir_UL(buffer);
-	}
-	
-	void c_Edges::e_U2() // Movement U2
-	{
-		S64 buffer = GetStatusPos_UF();
-		PutStatusPos_UF(GetStatusPos_UB());
-		PutStatusPos_UB(buffer);
-	
-		buffer = GetStatusDir_UF();
-		PutStatusDir_UF(GetStatusDir_UB());
-		PutStatusDir_UB(buffer);
-	
-		buffer = GetStatusPos_UL();
-		PutStatusPos_UL(GetStatusPos_UR());
-		PutStatusPos_UR(buffer);
-	
-		buffer = GetStatusDir_UL();
-		PutStatusDir_UL(GetStatusDir_UR());
-		PutStatusDir_UR(buffer);
-	}
-	
-	void c_Edges::e_Up() // Movement U'
-	{
-		S64 buffer = GetStatusPos_UF();
-		PutStatusPos_UF(GetStatusPos_UL());
-		PutStatusPos_UL(GetStatusPos_UB());
-		PutStatusPos_UB(GetStatusPos_UR());
-		PutStatusPos_UR(buffer);
-	
-		buffer = GetStatusDir_UF();
-		PutStatusDir_UF(GetStatusDir_UL());
-		PutStatusDir_UL(GetStatusDir_UB());
-		PutStatusDir_UB(GetStatusDir_UR());
-		PutStatusDir_UR(buffer);
-	}
-	
-	void c_Edges::e_D() // Movement D
-	{
-		S64 buffer = GetStatusPos_DF();
-		PutStatusPos_DF(GetStatusPos_DL());
-		PutStatusPos_DL(GetStatusPos_DB());
-		PutStatusPos_DB(GetStatusPos_DR());
-		PutStatusPos_DR(buffer);
-	
-		buffer = GetStatusDir_DF();
-		PutStatusDir_DF(GetStatusDir_DL());
-		PutStatusDir_DL(GetStatusDir_DB());
-		PutStatusDir_DB(GetStatusDir_DR());
-		PutStatusDir_DR(buffer);
-	}
-	
-	void c_Edges::e_D2() // Movement D2
-	{
-		S64 buffer = GetStatusPos_DF();
-		PutStatusPos_DF(GetStatusPos_DB());
-		PutStatusPos_DB(buffer);
-	
-		buffer = GetStatusDir_DF();
-		PutStatusDir_DF(GetStatusDir_DB());
-		PutStatusDir_DB(buffer);
-	
-		buffer = GetStatusPos_DL();
-		PutStatusPos_DL(GetStatusPos_DR());
-		PutStatusPos_DR(buffer);
-	
-		buffer = GetStatusDir_DL();
-		PutStatusDir_DL(GetStatusDir_DR());
-		PutStatusDir_DR(buffer);
-	}
-	
-	void c_Edges::e_Dp() // Movement D'
-	{
-		S64 buffer = GetStatusPos_DF();
-		PutStatusPos_DF(GetStatusPos_DR());
-		PutStatusPos_DR(GetStatusPos_DB());
-		PutStatusPos_DB(GetStatusPos_DL());
-		PutStatusPos_DL(buffer);
-	
-		buffer = GetStatusDir_DF();
-		PutStatusDir_DF(GetStatusDir_DR());
-		PutStatusDir_DR(GetStatusDir_DB());
-		PutStatusDir_DB(GetStatusDir_DL());
-		PutStatusDir_DL(buffer);
-	}
-	
-	void c_Edges::e_F() // Movement F
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_UF());
-		PutStatusPos_UF(GetStatusPos_FL());
-		PutStatusPos_FL(GetStatusPos_DF());
-		PutStatusPos_DF(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_UF() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_UF(GetStatusDir_FL() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_FL(GetStatusDir_DF() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_DF(buffer == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-	
-	}
-	
-	void c_Edges::e_F2() // Movement F2
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_FL());
-		PutStatusPos_FL(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_FL());
-		PutStatusDir_FL(buffer);
-	
-		buffer = GetStatusPos_UF();
-		PutStatusPos_UF(GetStatusPos_DF());
-		PutStatusPos_DF(buffer);
-	
-		buffer = GetStatusDir_UF();
-		PutStatusDir_UF(GetStatusDir_DF());
-		PutStatusDir_DF(buffer);
-	}
-	
-	void c_Edges::e_Fp() // Movement F'
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_DF());
-		PutStatusPos_DF(GetStatusPos_FL());
-		PutStatusPos_FL(GetStatusPos_UF());
-		PutStatusPos_UF(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_DF() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_DF(GetStatusDir_FL() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_FL(GetStatusDir_UF() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_UF(buffer == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-	}
-	
-	void c_Edges::e_B() // Movement B
-	{
-		S64 buffer = GetStatusPos_BL();
-		PutStatusPos_BL(GetStatusPos_UB());
-		PutStatusPos_UB(GetStatusPos_BR());
-		PutStatusPos_BR(GetStatusPos_DB());
-		PutStatusPos_DB(buffer);
-	
-		buffer = GetStatusDir_BL();
-		PutStatusDir_BL(GetStatusDir_UB() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_UB(GetStatusDir_BR() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_BR(GetStatusDir_DB() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_DB(buffer == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
+	// Edges directions for positive orientation from the orientation group of each spin: the direction is inverted
+	// for the positions of the group and for the edges of the group
+	template <typename O> static constexpr FixedTable3<Edd, 24, 12, 12> OrientationPOS(const O (&Orientation)[24])
+	{
+		FixedTable3<Edd, 24, 12, 12> Dirs{};
+		for (uint sp = 0u; sp < 24u; sp++)
+			for (uint p = 0u; p < 12u; p++)
+				for (uint e = 0u; e < 12u; e++)
+					Dirs[sp][p][e] = static_cast<Edd>(((Orientation[sp].Positions >> (48u + p)) ^ (Orientation[sp].Positions >> (48u + e))) & 0x1u);
+		return Dirs;
 	}
 
-	void c_Edges::e_B2() // Movement B2
-	{
-		S64 buffer = GetStatusPos_BL();
-		PutStatusPos_BL(GetStatusPos_BR());
-		PutStatusPos_BR(buffer);
-	
-		buffer = GetStatusDir_BL();
-		PutStatusDir_BL(GetStatusDir_BR());
-		PutStatusDir_BR(buffer);
-	
-		buffer = GetStatusPos_UB();
-		PutStatusPos_UB(GetStatusPos_DB());
-		PutStatusPos_DB(buffer);
-	
-		buffer = GetStatusDir_UB();
-		PutStatusDir_UB(GetStatusDir_DB());
-		PutStatusDir_DB(buffer);
-	}
-	
-	void c_Edges::e_Bp() // Movement B'
-	{
-		S64 buffer = GetStatusPos_BR();
-		PutStatusPos_BR(GetStatusPos_UB());
-		PutStatusPos_UB(GetStatusPos_BL());
-		PutStatusPos_BL(GetStatusPos_DB());
-		PutStatusPos_DB(buffer);
-	
-		buffer = GetStatusDir_BR();
-		PutStatusDir_BR(GetStatusDir_UB() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_UB(GetStatusDir_BL() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_BL(GetStatusDir_DB() == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-		PutStatusDir_DB(buffer == EDGE_DIR_POS ? EDGE_DIR_NEG : EDGE_DIR_POS);
-	}
-	
-	void c_Edges::e_R() // Movement R
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_DR());
-		PutStatusPos_DR(GetStatusPos_BR());
-		PutStatusPos_BR(GetStatusPos_UR());
-		PutStatusPos_UR(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_DR());
-		PutStatusDir_DR(GetStatusDir_BR());
-		PutStatusDir_BR(GetStatusDir_UR());
-		PutStatusDir_UR(buffer);
-	}
-	
-	void c_Edges::e_R2() // Movement R2
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_BR());
-		PutStatusPos_BR(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_BR());
-		PutStatusDir_BR(buffer);
-	
-		buffer = GetStatusPos_UR();
-		PutStatusPos_UR(GetStatusPos_DR());
-		PutStatusPos_DR(buffer);
-	
-		buffer = GetStatusDir_UR();
-		PutStatusDir_UR(GetStatusDir_DR());
-		PutStatusDir_DR(buffer);
-	}
-	
-	void c_Edges::e_Rp() // Movement R'
-	{
-		S64 buffer = GetStatusPos_FR();
-		PutStatusPos_FR(GetStatusPos_UR());
-		PutStatusPos_UR(GetStatusPos_BR());
-		PutStatusPos_BR(GetStatusPos_DR());
-		PutStatusPos_DR(buffer);
-	
-		buffer = GetStatusDir_FR();
-		PutStatusDir_FR(GetStatusDir_UR());
-		PutStatusDir_UR(GetStatusDir_BR());
-		PutStatusDir_BR(GetStatusDir_DR());
-		PutStatusDir_DR(buffer);
-	}
-	
-	void c_Edges::e_L() // Movement L
-	{
-		S64 buffer = GetStatusPos_FL();
-		PutStatusPos_FL(GetStatusPos_UL());
-		PutStatusPos_UL(GetStatusPos_BL());
-		PutStatusPos_BL(GetStatusPos_DL());
-		PutStatusPos_DL(buffer);
-	
-		buffer = GetStatusDir_FL();
-		PutStatusDir_FL(GetStatusDir_UL());
-		PutStatusDir_UL(GetStatusDir_BL());
-		PutStatusDir_BL(GetStatusDir_DL());
-		PutStatusDir_DL(buffer);
-	}
-	
-	void c_Edges::e_L2() // Movement L2
-	{
-		S64 buffer = GetStatusPos_FL();
-		PutStatusPos_FL(GetStatusPos_BL());
-		PutStatusPos_BL(buffer);
-	
-		buffer = GetStatusDir_FL();
-		PutStatusDir_FL(GetStatusDir_BL());
-		PutStatusDir_BL(buffer);
-	
-		buffer = GetStatusPos_UL();
-		PutStatusPos_UL(GetStatusPos_DL());
-		PutStatusPos_DL(buffer);
-	
-		buffer = GetStatusDir_UL();
-		PutStatusDir_UL(GetStatusDir_DL());
-		PutStatusDir_DL(buffer);
-	}
-	
-	void c_Edges::e_Lp() // Movement L'
+	constexpr FixedTable3<Edd, 24, 12, 12> c_Edges::edd_OrientationPOS = OrientationPOS(e_Orientation);
+
+	// Face turns as bits permutations of the edges status, from Stp::NONE to Stp::L2
+	const c_Edges::EdgesTurn c_Edges::e_Turns[19] =
+	{ //      Keep                   Flip                   Masks (bits moved by the same rotation)                                                                                                                                                                 Rotations
+		{ 0x0FFFFFFFFFFFFFFFULL, 0x0000000000000000ULL, { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  0,  0,  0,  0,  0,  0,  0,  0 } }, // NONE
+		{ 0x0F0FFFFF0000FFFFULL, 0x0000000000000000ULL, { 0x0070000000000000ULL, 0x000000000FFF0000ULL, 0x00000000F0000000ULL, 0x0080000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  1,  4, 52, 61,  0,  0,  0,  0 } }, // U
+		{ 0x0F0FFFFF0000FFFFULL, 0x0000000000000000ULL, { 0x0010000000000000ULL, 0x00000000000F0000ULL, 0x00000000FFF00000ULL, 0x00E0000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  3, 12, 60, 63,  0,  0,  0,  0 } }, // U'
+		{ 0x0F0FFFFF0000FFFFULL, 0x0000000000000000ULL, { 0x0030000000000000ULL, 0x0000000000FF0000ULL, 0x00000000FF000000ULL, 0x00C0000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  2,  8, 56, 62,  0,  0,  0,  0 } }, // U2
+		{ 0x00FF0000FFFFFFFFULL, 0x0000000000000000ULL, { 0x0100000000000000ULL, 0x0000000F00000000ULL, 0x0000FFF000000000ULL, 0x0E00000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  3, 12, 60, 63,  0,  0,  0,  0 } }, // D
+		{ 0x00FF0000FFFFFFFFULL, 0x0000000000000000ULL, { 0x0700000000000000ULL, 0x00000FFF00000000ULL, 0x0000F00000000000ULL, 0x0800000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  1,  4, 52, 61,  0,  0,  0,  0 } }, // D'
+		{ 0x00FF0000FFFFFFFFULL, 0x0000000000000000ULL, { 0x0300000000000000ULL, 0x000000FF00000000ULL, 0x0000FF0000000000ULL, 0x0C00000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  2,  8, 56, 62,  0,  0,  0,  0 } }, // D2
+		{ 0x0EECFFF0FFF0FF00ULL, 0x0113000000000000ULL, { 0x0002000000000000ULL, 0x0001000000000000ULL, 0x00000000000000F0ULL, 0x000000000000000FULL, 0x0000000F00000000ULL, 0x00000000000F0000ULL, 0x0100000000000000ULL, 0x0010000000000000ULL }, {  3,  8, 12, 32, 36, 48, 57, 60 } }, // F
+		{ 0x0EECFFF0FFF0FF00ULL, 0x0113000000000000ULL, { 0x0001000000000000ULL, 0x0002000000000000ULL, 0x000000000000000FULL, 0x00000000000000F0ULL, 0x0000000F00000000ULL, 0x00000000000F0000ULL, 0x0100000000000000ULL, 0x0010000000000000ULL }, {  4,  7, 16, 28, 32, 52, 56, 61 } }, // F'
+		{ 0x0EECFFF0FFF0FF00ULL, 0x0000000000000000ULL, { 0x0001000000000000ULL, 0x001000000000000FULL, 0x00000000000F0000ULL, 0x0000000F00000000ULL, 0x01000000000000F0ULL, 0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  1,  4, 16, 48, 60, 63,  0,  0 } }, // F2
+		{ 0x0BB3F0FFF0FF00FFULL, 0x044C000000000000ULL, { 0x0008000000000000ULL, 0x0004000000000000ULL, 0x000000000000F000ULL, 0x0000000000000F00ULL, 0x00000F0000000000ULL, 0x000000000F000000ULL, 0x0400000000000000ULL, 0x0040000000000000ULL }, {  3,  8, 12, 32, 36, 48, 57, 60 } }, // B
+		{ 0x0BB3F0FFF0FF00FFULL, 0x044C000000000000ULL, { 0x0004000000000000ULL, 0x0008000000000000ULL, 0x0000000000000F00ULL, 0x000000000000F000ULL, 0x00000F0000000000ULL, 0x000000000F000000ULL, 0x0400000000000000ULL, 0x0040000000000000ULL }, {  4,  7, 16, 28, 32, 52, 56, 61 } }, // B'
+		{ 0x0BB3F0FFF0FF00FFULL, 0x0000000000000000ULL, { 0x0004000000000000ULL, 0x0040000000000F00ULL, 0x000000000F000000ULL, 0x00000F0000000000ULL, 0x040000000000F000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  1,  4, 16, 48, 60, 63,  0,  0 } }, // B2
+		{ 0x07760FFF0FFF0FF0ULL, 0x0000000000000000ULL, { 0x0001000000000000ULL, 0x0008000000000000ULL, 0x0000F00000000000ULL, 0x000000000000000FULL, 0x000000000000F000ULL, 0x00000000F0000000ULL, 0x0800000000000000ULL, 0x0080000000000000ULL }, {  7,  8, 20, 28, 32, 48, 53, 60 } }, // R
+		{ 0x07760FFF0FFF0FF0ULL, 0x0000000000000000ULL, { 0x0008000000000000ULL, 0x0001000000000000ULL, 0x000000000000F000ULL, 0x0000F00000000000ULL, 0x00000000F0000000ULL, 0x000000000000000FULL, 0x0800000000000000ULL, 0x0080000000000000ULL }, {  4, 11, 16, 32, 36, 44, 56, 57 } }, // R'
+		{ 0x07760FFF0FFF0FF0ULL, 0x0000000000000000ULL, { 0x0001000000000000ULL, 0x0080000000000000ULL, 0x000000000000000FULL, 0x00000000F0000000ULL, 0x0000F00000000000ULL, 0x000000000000F000ULL, 0x0800000000000000ULL, 0x0008000000000000ULL }, {  3,  4, 12, 16, 48, 52, 60, 61 } }, // R2
+		{ 0x0DD9FF0FFF0FF00FULL, 0x0000000000000000ULL, { 0x0004000000000000ULL, 0x0002000000000000ULL, 0x0000000000000F00ULL, 0x00000000000000F0ULL, 0x000000F000000000ULL, 0x0000000000F00000ULL, 0x0200000000000000ULL, 0x0020000000000000ULL }, {  3,  8, 12, 32, 36, 48, 57, 60 } }, // L
+		{ 0x0DD9FF0FFF0FF00FULL, 0x0000000000000000ULL, { 0x0002000000000000ULL, 0x0004000000000000ULL, 0x00000000000000F0ULL, 0x0000000000000F00ULL, 0x000000F000000000ULL, 0x0000000000F00000ULL, 0x0200000000000000ULL, 0x0020000000000000ULL }, {  4,  7, 16, 28, 32, 52, 56, 61 } }, // L'
+		{ 0x0DD9FF0FFF0FF00FULL, 0x0000000000000000ULL, { 0x0002000000000000ULL, 0x00200000000000F0ULL, 0x0000000000F00000ULL, 0x000000F000000000ULL, 0x0200000000000F00ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, {  1,  4, 16, 48, 60, 63,  0,  0 } }  // L2
+	};
+
+#ifdef GRCUBE3_SIMD_TURNS
+	// Face turns as bytes shuffles of the expanded edges, from Stp::NONE to Stp::L2
+	constexpr c_Edges::EdgesShuffle c_Edges::e_Shuffles[19] =
+	{ //     Shuffle (source position)                                        Flip
+		{ {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // NONE
+		{ {  0,  1,  2,  3,  7,  4,  5,  6,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U
+		{ {  0,  1,  2,  3,  5,  6,  7,  4,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U'
+		{ {  0,  1,  2,  3,  6,  7,  4,  5,  8,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U2
+		{ {  0,  1,  2,  3,  4,  5,  6,  7,  9, 10, 11,  8, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D
+		{ {  0,  1,  2,  3,  4,  5,  6,  7, 11,  8,  9, 10, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D'
+		{ {  0,  1,  2,  3,  4,  5,  6,  7, 10, 11,  8,  9, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // D2
+		{ {  4,  8,  2,  3,  1,  5,  6,  7,  0,  9, 10, 11, 12, 13, 14, 15 }, { 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F
+		{ {  8,  4,  2,  3,  0,  5,  6,  7,  1,  9, 10, 11, 12, 13, 14, 15 }, { 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F'
+		{ {  1,  0,  2,  3,  8,  5,  6,  7,  4,  9, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // F2
+		{ {  0,  1,  6, 10,  4,  5,  3,  7,  8,  9,  2, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B
+		{ {  0,  1, 10,  6,  4,  5,  2,  7,  8,  9,  3, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B'
+		{ {  0,  1,  3,  2,  4,  5, 10,  7,  8,  9,  6, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // B2
+		{ { 11,  1,  2,  7,  4,  5,  6,  0,  8,  9, 10,  3, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R
+		{ {  7,  1,  2, 11,  4,  5,  6,  3,  8,  9, 10,  0, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R'
+		{ {  3,  1,  2,  0,  4,  5,  6, 11,  8,  9, 10,  7, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // R2
+		{ {  0,  5,  9,  3,  4,  2,  6,  7,  8,  1, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // L
+		{ {  0,  9,  5,  3,  4,  1,  6,  7,  8,  2, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // L'
+		{ {  0,  2,  1,  3,  4,  9,  6,  7,  8,  5, 10, 11, 12, 13, 14, 15 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }  // L2
+	};
+
+	// Layer turns: the face turns followed by the slice turns. The two face turns of a slice turn move disjoint edges,
+	// so each edge takes the source position and flip from the face turn that moves it
+	template <typename T> static constexpr FixedTable<T, LAYER_TURNS> LayerShuffles(const T (&Faces)[19])
 	{
-		S64 buffer = GetStatusPos_FL();
-		PutStatusPos_FL(GetStatusPos_DL());
-		PutStatusPos_DL(GetStatusPos_BL());
-		PutStatusPos_BL(GetStatusPos_UL());
-		PutStatusPos_UL(buffer);
-	
-		buffer = GetStatusDir_FL();
-		PutStatusDir_FL(GetStatusDir_DL());
-		PutStatusDir_DL(GetStatusDir_BL());
-		PutStatusDir_BL(GetStatusDir_UL());
-		PutStatusDir_UL(buffer);
+		FixedTable<T, LAYER_TURNS> Turns{};
+		for (uint t = 0u; t < SLICE_TURNS_FIRST; t++) Turns[t] = Faces[t];
+		for (uint t = 0u; t < LAYER_TURNS - SLICE_TURNS_FIRST; t++)
+		{
+			const T& F1 = Faces[static_cast<int>(stp_SliceTurns[t][0])];
+			const T& F2 = Faces[static_cast<int>(stp_SliceTurns[t][1])];
+			T& Slice = Turns[SLICE_TURNS_FIRST + t];
+			for (uint b = 0u; b < 16u; b++)
+			{
+				Slice.Shuffle[b] = F1.Shuffle[b] != b ? F1.Shuffle[b] : F2.Shuffle[b];
+				Slice.Flip[b] = F1.Flip[b] | F2.Flip[b];
+			}
+		}
+		return Turns;
 	}
+
+	constexpr FixedTable<c_Edges::EdgesShuffle, LAYER_TURNS> c_Edges::e_LayerShuffles = LayerShuffles(e_Shuffles);
+#endif
 	
 	// Invert edges direction status bit
 	void c_Edges::InvertStatusDir(const Edp ep)
@@ -70,6 +70,19 @@ namespace grcube3
         // Check if edges coded in given mask are solved (default = all edges)
 		bool IsSolvedEdges(const S64 EMask = EMASK_DATA) const { return (edges & EMask) == (EMASK_SOLVED & EMask); }
 
+		// Check if edges in the positions coded in given mask (direction bits) have positive orientation for the given spin
+		// The orientation is the edge direction, inverted for the positions and the edges in the orientation group of the spin
+		bool IsOrientedEdges(const S64 EMask, const Spn sp) const
+		{
+			const EdgesOrientation& EO = e_Orientation[static_cast<int>(sp)];
+			S64 Group = ((edges >> 2) | (edges >> 3)) & ~(edges & EO.Odd) & EO.Group; // Bit 4p set if the edge in position p is in the group
+			Group = (Group | (Group >> 3)) & 0x0303030303030303ULL; // Pack the group bits as the direction bits
+			Group = (Group | (Group >> 6)) & 0x000F000F000F000FULL;
+			Group = (Group | (Group >> 12)) & 0x000000FF000000FFULL;
+			Group = (Group | (Group >> 24)) & 0x0000000000000FFFULL;
+			return ((edges ^ (Group << 48) ^ EO.Positions) & EMask & EMASK_DIR_DATA) == 0ull;
+		}
+
 		// Check if an edge is solved
 		bool IsSolved_FR() const { return GetEdge_FR() == Edg::FR && GetEdgeDir_FR() == Edd::POS; }
 		bool IsSolved_FL() const { return GetEdge_FL() == Edg::FL && GetEdgeDir_FL() == Edd::POS; }
@@ -248,19 +261,92 @@ namespace grcube3
 		// Absolute edge positions from spin and edge positions
         const static Aep aep_Positions[24][12];
 		
-		// Edge positions from spin and absolut edge positions
-        const static Edp edp_Absolut[24][12];
+		// Edge positions from spin and absolut edge positions (inverse of aep_Positions)
+        const static FixedTable2<Edp, 24, 12> edp_Absolut;
+
+		// Edges directions for positive orientation (generated from e_Orientation)
+		const static FixedTable3<Edd, 24, 12, 12> edd_OrientationPOS;
+
+		// Positive orientation for a spin as bits operations: the edges in the orientation group (none, U and D layers edges or
+		// M slice edges) and the positions of the group have the direction inverted
+		struct EdgesOrientation
+		{
+			S64 Group; // Bit 0 of each edge position data if the spin has an orientation group
+			S64 Odd; // Bit 0 of each edge position data if the odd edges (UL, UR, DL, DR) are not in the group
+			S64 Positions; // Direction bits for the positions of the group
+		};
 
-		// Edges directions for positive orientation
-		const static Edd edd_OrientationPOS[24][12][12];
+		// Positive orientation for each spin
+		const static EdgesOrientation e_Orientation[24];
 		
-		// Movements
-		void e_U();	void e_U2(); void e_Up();
-		void e_D();	void e_D2(); void e_Dp();
-		void e_F();	void e_F2(); void e_Fp();
-		void e_B();	void e_B2(); void e_Bp();
-		void e_R();	void e_R2(); void e_Rp();
-		void e_L();	void e_L2(); void e_Lp();
+		// Face turn coded as a bits permutation of the edges status
+		struct EdgesTurn
+		{
+			S64 Keep; // Bits not moved by the turn
+			S64 Flip; // Directions inverted by the turn
+			S64 Masks[8]; // Groups of bits moved by the same rotation
+			uint Rotations[8]; // Left rotation for each group of bits
+		};
+
+		// Face turns from Stp::NONE to Stp::L2
+		const static EdgesTurn e_Turns[19];
+
+#ifdef GRCUBE3_SIMD_TURNS
+		// Face turn as a bytes shuffle of the edges, with one byte for each edge (position in bits 0-3, direction in bit 4)
+		struct EdgesShuffle
+		{
+			alignas(16) uint8_t Shuffle[16]; // Source edge position for each edge position
+			alignas(16) uint8_t Flip[16]; // Directions inverted by the turn
+		};
+
+		// Face turns from Stp::NONE to Stp::L2
+		const static EdgesShuffle e_Shuffles[19];
+
+		// Layer turns (see LAYER_TURNS): the face turns followed by the slice turns, merged from their two face turns
+		const static FixedTable<EdgesShuffle, LAYER_TURNS> e_LayerShuffles;
+
+		// Movements (layer turn index, see LAYER_TURNS)
+		void e_Turn(const uint L)
+		{
+			const EdgesShuffle& T = e_LayerShuffles[L];
+			const __m128i Nibbles = _mm_set1_epi8(0x0F);
+			const __m128i Status = _mm_cvtsi64_si128(static_cast<long long>(edges));
+
+			// Expand the edges status to one byte for each edge
+			const __m128i Bits = _mm_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+			const __m128i Dirs = _mm_shuffle_epi8(_mm_srli_epi64(Status, 48), _mm_set_epi8(1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+			__m128i Bytes = _mm_unpacklo_epi8(_mm_and_si128(Status, Nibbles), _mm_and_si128(_mm_srli_epi16(Status, 4), Nibbles));
+			Bytes = _mm_or_si128(Bytes, _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(Dirs, Bits), Bits), _mm_set1_epi8(0x10)));
+
+			// Turn
+			Bytes = _mm_shuffle_epi8(Bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(T.Shuffle)));
+			Bytes = _mm_xor_si128(Bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(T.Flip)));
+
+			// Pack the bytes again: two positions for each byte and the direction bits
+			const __m128i Pairs = _mm_maddubs_epi16(_mm_and_si128(Bytes, Nibbles), _mm_set1_epi16(0x1001));
+			const S64 Pos = static_cast<S64>(_mm_cvtsi128_si64(_mm_packus_epi16(Pairs, Pairs))) & EMASK_POS_DATA;
+			const S64 Dir = static_cast<S64>(_mm_movemask_epi8(_mm_slli_epi16(Bytes, 3)) & 0x0FFF) << 48;
+			edges = Pos | Dir;
+		}
+#else
+		// Face turn (only Stp::NONE to Stp::L2 steps)
+		void e_Turn(const EdgesTurn& T)
+		{
+			S64 e = edges & T.Keep;
+			for (int n = 0; n < 8; n++) e |= RotateLeft(edges & T.Masks[n], T.Rotations[n]);
+			edges = e ^ T.Flip;
+		}
+
+		// Movements (layer turn index, see LAYER_TURNS)
+		// The slice turns need more rotation groups than a face turn, so they are applied as their two face turns
+		void e_Turn(const uint L)
+		{
+			if (L < SLICE_TURNS_FIRST) { e_Turn(e_Turns[L]); return; }
+			const Stp* Faces = stp_SliceTurns[L - SLICE_TURNS_FIRST];
+			e_Turn(e_Turns[static_cast<int>(Faces[0])]);
+			e_Turn(e_Turns[static_cast<int>(Faces[1])]);
+		}
+#endif
 				
 		void e_Reset() { edges = EMASK_SOLVED; } // Reset edges status
 
@@ -64,6 +64,8 @@ namespace grcube3
 		TimeFLCross = TimeFLCorners = TimeSL = TimeLLCross1 = TimeLLCross2 = TimeLLCorners1 = TimeLLCorners2 = 0.0f;
 		
 		Metric = Metrics::Movements; // Default metric
+
+		Stats.Reset();
 	}
 	
 	// Search the best first layer cross solve algorithm
@@ -148,6 +150,7 @@ namespace grcube3
 			if (Cross_1_IsSolved && Cross_2_IsSolved && Cross_3_IsSolved && Cross_4_IsSolved) break;
 
 			DeepSearch DS_Cross(Cross_Aux);
+			DS_Cross.SetBudget(Budget);
 
             for (int n = 0; n < 5; n++) DS_Cross.AddSearchLevel(L); // Search depth is 5
 			DS_Cross.UpdateRootData();
@@ -165,6 +168,7 @@ namespace grcube3
 			else DS_Cross.AddToOptionalPieces(Cross_4);
 
 			DS_Cross.Run(Cores);
+			Stats.Add(DS_Cross.GetStats());
 
 			DS_Cross.EvaluateShortestResult(Cross_Aux, true);
 
@@ -295,6 +299,7 @@ namespace grcube3
 			if (FL_1_IsSolved && FL_2_IsSolved && FL_3_IsSolved && FL_4_IsSolved) break;
 
 			DeepSearch DS_FL(FL_Aux);
+			DS_FL.SetBudget(Budget);
 
 			DS_FL.AddSearchLevel(L_FL_Check);
 			DS_FL.AddSearchLevel(L_FL_Check);
@@ -318,6 +323,7 @@ namespace grcube3
 			else DS_FL.AddToOptionalPieces(FL_4);
 
 			DS_FL.Run(Cores);
+			Stats.Add(DS_FL.GetStats());
 
 			DS_FL.EvaluateShortestResult(FL_Aux, true);
 
@@ -446,6 +452,7 @@ namespace grcube3
 			if (SL_1_IsSolved && SL_2_IsSolved && SL_3_IsSolved && SL_4_IsSolved) break;
 
 			DeepSearch DS_SL(SL_Aux);
+			DS_SL.SetBudget(Budget);
 
 			DS_SL.AddSearchLevel(L_SL_Check);
 			DS_SL.AddSearchLevel(L_SL_Check);
@@ -469,6 +476,7 @@ namespace grcube3
 			else DS_SL.AddToOptionalPieces(SL_4);
 
 			DS_SL.Run(Cores);
+			Stats.Add(DS_SL.GetStats());
 
 			std::vector<Algorithm> SLSolves;
             Method::EvaluateCFOPF2LResult(SLSolves, 1u, DS_SL.GetSolves(), CubeSL, FirstLayer, Plc::SHORT);
@@ -524,6 +532,7 @@ namespace grcube3
 		const Cube C(AlgStart);
 
         DeepSearch DSLLCross1(AlgStart, Plc::SHORT);
+        DSLLCross1.SetBudget(Budget);
 		
 		switch (FirstLayer)
 		{
@@ -579,6 +588,7 @@ namespace grcube3
         DSLLCross1.UpdateRootData();
 
         DSLLCross1.Run(Cores);
+        Stats.Add(DSLLCross1.GetStats());
 		
 		DSLLCross1.EvaluateShortestResult(LLCross1, true);
 		
@@ -600,6 +610,7 @@ namespace grcube3
 		const Cube C(AlgStart);
 
         DeepSearch DSLLCross2(AlgStart, Plc::SHORT);
+        DSLLCross2.SetBudget(Budget);
 		
 		switch (FirstLayer)
 		{
@@ -655,6 +666,7 @@ namespace grcube3
         DSLLCross2.UpdateRootData();
 
         DSLLCross2.Run(Cores);
+        Stats.Add(DSLLCross2.GetStats());
 		
 		DSLLCross2.EvaluateShortestResult(LLCross2, true);
 		
@@ -677,6 +689,7 @@ namespace grcube3
 		const Cube C(AlgStart);
 
         DeepSearch DSLLCorners1(AlgStart, Plc::SHORT);
+        DSLLCorners1.SetBudget(Budget);
 		
 		switch (FirstLayer)
 		{
@@ -738,6 +751,7 @@ namespace grcube3
         DSLLCorners1.UpdateRootData();
 
         DSLLCorners1.Run(Cores);
+        Stats.Add(DSLLCorners1.GetStats());
 		
 		DSLLCorners1.EvaluateShortestResult(LLCorners1, true);
 		
@@ -761,6 +775,7 @@ namespace grcube3
 		if (Cube(AlgStart).IsSolved()) return;
 
         DeepSearch DSLLCorners2(AlgStart, Plc::SHORT);
+        DSLLCorners2.SetBudget(Budget);
 		
 		DSLLCorners2.AddToMandatoryPieces(Pgr::ALL);
 		
@@ -781,6 +796,7 @@ namespace grcube3
         DSLLCorners2.UpdateRootData();
 
         DSLLCorners2.Run(Cores);
+        Stats.Add(DSLLCorners2.GetStats());
 		
         EvaluateLLCOResult(LLCorners2, DSLLCorners2.GetSolves());
 		
@@ -998,6 +1014,7 @@ namespace grcube3
         Report += "First layer corners time: " + std::to_string(GetTimeFLCorners()) + " s\n";
         Report += "Second layer time: " + std::to_string(GetTimeSL()) + " s\n";
         Report += "Last layer time: " + std::to_string(GetTimeLL()) + " s\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
@@ -32,7 +32,7 @@ namespace grcube3
 	{
 	public:
 		// Constructor
-		LBL(const Algorithm& Scr, const int NumCores = 0) { Scramble = Scr; Reset(); Cores = NumCores; }
+		LBL(const Algorithm& Scr, const int NumCores = 0) { Scramble = Scr; Reset(); Cores = NumCores; Budget = nullptr; }
 
 		// Reset the search results
 		void Reset();
@@ -191,6 +191,16 @@ namespace grcube3
 		// Get used cores in the solve
 		int GetUsedCores() const { return Cores; }
 
+		// Limits for all the searches (nullptr for no limits)
+		void SetBudget(SearchBudget* B) { Budget = B; }
+
+		// Some search was stopped by the budget, so the solve could be incomplete
+		bool IsTruncated() const { return Budget != nullptr && Budget->IsExhausted(); }
+
+		// Statistics for the solve searches (empty report without GRCUBE3_SEARCH_STATS)
+		const SearchStats& GetSearchStats() const { return Stats; }
+		std::string GetSearchStatsReport() const { return Stats.GetReport(); }
+
         char GetCrossLayer() const { return Cube::GetLayerChar(FirstLayer); }
 
 		// Returns the shorter LBL last layer corners orientation algorithm from the solves
@@ -219,6 +229,10 @@ namespace grcube3
 
 		int Cores; // Cores to use in the search: -1 = no multithreading, 0 = all avaliable cores, other = use this amount of cores
 
+		SearchBudget* Budget; // Limits for the searches (nullptr if no limits)
+
+		SearchStats Stats; // Statistics for all the solve searches
+
 		const static Algorithm Inspections[6], 
 			                   Cross1Algorithm,
 							   Cross2Algorithm,
@@ -973,6 +973,7 @@ namespace grcube3
         Report += "Last layer time: " + std::to_string(GetTimeLL()) + " s\n";
         Report += "Threads used: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
@@ -1741,7 +1741,7 @@ void MainWindow::on_lineEdit_Scramble_textChanged(const QString &scrInput)
         Algorithm A(ui->lineEdit_Scramble->text().toStdString().c_str());
         Algorithm B = A.GetSimplified();
         B = B.GetWithoutTurns();
-        while (B.Shrink());
+        B.ShrinkAll();
 
         if (B.GetSize() < 12u) // Scramble too short to evaluate
         {
@@ -1989,7 +1989,7 @@ void MainWindow::on_pushButton_StartSearch_clicked()
     Algorithm Scramble(ui->lineEdit_Scramble->text().toStdString().c_str());
     Scramble = Scramble.GetSimplified();
     Scramble = Scramble.GetWithoutTurns();
-    while (Scramble.Shrink());
+    Scramble.ShrinkAll();
 
     ui->statusBar->showMessage(CurrentLang["SearchStarted"]);
 
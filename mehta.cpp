@@ -1343,6 +1343,7 @@ namespace grcube3
 
         Report += "Threads used: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
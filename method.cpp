@@ -21,6 +21,8 @@
 */
 
 #include "method.h"
+#include "cube_delta.h"
+#include "cube_batch.h"
 
 #include <chrono>
 #include <algorithm>
@@ -142,102 +144,112 @@ namespace grcube3
         Spn Spin1, Spin2; // Cube spins before and after applying algorithm
         Stp StepS1, StepS2; // Steps to return cube to the start spin
 
+        // Cube after each y turn, and the pieces status that each AUF solves for the spin after the y turn: the algorithm
+        // solves the cube with an AUF if it leaves the pieces status of a solved cube after the inverse AUF (the turns
+        // to return to the start spin don't change the pieces status)
+        std::array<Cube, 4u> CubesY;
+        std::array<CubeBatch, 4u> AUFTargets;
+        for (uint y = 0u; y < Algorithm::yTurns.size(); y++)
+        {
+            CubesY[y] = CubeBase;
+            CubesY[y].ApplyStep(Algorithm::yTurns[y]);
+            for (const auto ULL : Algorithm::UMovs)
+            {
+                Cube Target;
+                Target.SetSpin(CubesY[y].GetSpin());
+                Target.ApplyStep(Algorithm::InvertedStep(ULL));
+                AUFTargets[y].Add(Target);
+            }
+        }
+
+        // Cubes with each U movement before algorithm (2GLL, the U movements don't change the spin)
+        CubeBatch CubesU, CubesLL;
+        if (AlgSet.GetName() == "2GLL")
+        {
+            for (const auto ULL1 : Algorithm::UMovs)
+            {
+                Cube CubeU = CubeBase;
+                CubeU.ApplyStep(ULL1);
+                CubesU.Add(CubeU);
+            }
+        }
+
         for (uint LL_Index = 0u; LL_Index < AlgSet.GetCasesNumber(); LL_Index++)
         {
             Algorithm Alg = AlgSet.GetAlgorithm(LL_Index, Pol, Met);
 
             if (AlgSet.GetName() == "2GLL")
             {
-                for (const auto ULL1 : Algorithm::UMovs) // U movement before algorithm
+                CubesLL = CubesU;
+                CubesLL.Apply(CubeDelta(Alg, CubeBase.GetSpin())); // Same effect for all U movements
+
+                for (uint U1 = 0u; U1 < CubesLL.GetSize(); U1++) // U movement before algorithm
                 {
-                    for (const auto ULL2 : Algorithm::UMovs) // U movement after algorithm (AUF)
-                    {
-                        Cube CubeLL = CubeBase;
-                        CubeLL.ApplyStep(ULL1);
-                        Spin1 = CubeLL.GetSpin();
-                        CubeLL.ApplyAlgorithm(Alg);
-                        Spin2 = CubeLL.GetSpin();
-                        if (Spin1 != Spin2)
-                        {
-                            Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
-                            if (StepS1 != Stp::NONE) CubeLL.ApplyStep(StepS1);
-                            if (StepS2 != Stp::NONE) CubeLL.ApplyStep(StepS2);
-                        }
-                        else StepS1 = StepS2 = Stp::NONE;
-                        CubeLL.ApplyStep(ULL2);
+                    const uint U2 = AUFTargets[0].Find(CubesLL.GetEdgesStatus(U1), CubesLL.GetCornersStatus(U1)); // AUF
+                    if (U2 == AUFTargets[0].GetSize()) continue;
 
-                        LL_Found = CubeLL.IsSolved();
+                    LL_Found = true;
+                    LLCase = AlgSet.GetCaseName(LL_Index);
 
-                        if (LL_Found)
-                        {
-                            LLCase = AlgSet.GetCaseName(LL_Index);
-
-                            if (ULL1 != Stp::NONE)
-                            {
-                                // LLSolve.Append(Stp::PARENTHESIS_OPEN);
-                                LLSolve.Append(ULL1);
-                                // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
-                            }
-                            LLSolve.Append(Alg);
-                            if (Cube::GetUpSliceLayer(Spin1) != Cube::GetUpSliceLayer(Spin2))
-                            {
-                                // LLSolve.Append(Stp::PARENTHESIS_OPEN);
-                                LLSolve.Append(StepS1);
-                                if (StepS2 != Stp::NONE) LLSolve.Append(StepS2);
-                                // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
-                            }
-                            AUFStep = ULL2;
-                            break;
-                        }
+                    const Stp ULL1 = Algorithm::UMovs[U1];
+                    Spin1 = CubeBase.GetSpin();
+                    Spin2 = CubesLL.GetSpin(U1);
+                    if (Spin1 != Spin2) Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
+                    else StepS1 = StepS2 = Stp::NONE;
+
+                    if (ULL1 != Stp::NONE)
+                    {
+                        // LLSolve.Append(Stp::PARENTHESIS_OPEN);
+                        LLSolve.Append(ULL1);
+                        // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
+                    }
+                    LLSolve.Append(Alg);
+                    if (Cube::GetUpSliceLayer(Spin1) != Cube::GetUpSliceLayer(Spin2))
+                    {
+                        // LLSolve.Append(Stp::PARENTHESIS_OPEN);
+                        LLSolve.Append(StepS1);
+                        if (StepS2 != Stp::NONE) LLSolve.Append(StepS2);
+                        // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
                     }
-                    if (LL_Found) break; // Release for loop
+                    AUFStep = Algorithm::UMovs[U2];
+                    break;
                 }
             }
             else
             {
-                for (const auto yLL : Algorithm::yTurns) // y turn before algorithm
+                for (uint y = 0u; y < CubesY.size(); y++) // y turn before algorithm
                 {
-                    for (const auto ULL : Algorithm::UMovs) // U movement after algorithm (AUF)
-                    {
-                        Cube CubeLL = CubeBase;
-                        CubeLL.ApplyStep(yLL);
-                        Spin1 = CubeLL.GetSpin();
-                        CubeLL.ApplyAlgorithm(Alg);
-                        Spin2 = CubeLL.GetSpin();
-                        if (Spin1 != Spin2)
-                        {
-                            Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
-                            if (StepS1 != Stp::NONE) CubeLL.ApplyStep(StepS1);
-                            if (StepS2 != Stp::NONE) CubeLL.ApplyStep(StepS2);
-                        }
-                        else StepS1 = StepS2 = Stp::NONE;
-                        CubeLL.ApplyStep(ULL);
+                    const Stp yLL = Algorithm::yTurns[y];
+                    Cube CubeLL = CubesY[y];
+                    Spin1 = CubeLL.GetSpin();
+                    CubeDelta(Alg, Spin1).Apply(CubeLL); // Algorithm effect for this spin, same for all AUFs
+                    Spin2 = CubeLL.GetSpin();
 
-                        LL_Found = CubeLL.IsSolved();
+                    const uint U = AUFTargets[y].Find(CubeLL); // AUF
+                    if (U == AUFTargets[y].GetSize()) continue;
 
-                        if (LL_Found)
-                        {
-                            LLCase = AlgSet.GetCaseName(LL_Index);
-
-                            if (yLL != Stp::NONE)
-                            {
-                                // LLSolve.Append(Stp::PARENTHESIS_OPEN);
-                                LLSolve.Append(yLL);
-                                // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
-                            }
-                            LLSolve.Append(Alg);
-                            if (Cube::GetUpSliceLayer(Spin1) != Cube::GetUpSliceLayer(Spin2))
-                            {
-                                // LLSolve.Append(Stp::PARENTHESIS_OPEN);
-                                LLSolve.Append(StepS1);
-                                if (StepS2 != Stp::NONE) LLSolve.Append(StepS2);
-                                // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
-                            }
-                            AUFStep = ULL;
-                            break;
-                        }
+                    LL_Found = true;
+                    LLCase = AlgSet.GetCaseName(LL_Index);
+
+                    if (Spin1 != Spin2) Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
+                    else StepS1 = StepS2 = Stp::NONE;
+
+                    if (yLL != Stp::NONE)
+                    {
+                        // LLSolve.Append(Stp::PARENTHESIS_OPEN);
+                        LLSolve.Append(yLL);
+                        // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
                     }
-                    if (LL_Found) break; // Release for loop
+                    LLSolve.Append(Alg);
+                    if (Cube::GetUpSliceLayer(Spin1) != Cube::GetUpSliceLayer(Spin2))
+                    {
+                        // LLSolve.Append(Stp::PARENTHESIS_OPEN);
+                        LLSolve.Append(StepS1);
+                        if (StepS2 != Stp::NONE) LLSolve.Append(StepS2);
+                        // LLSolve.Append(Stp::PARENTHESIS_CLOSE_1_REP);
+                    }
+                    AUFStep = Algorithm::UMovs[U];
+                    break;
                 }
             }
 
@@ -274,35 +286,54 @@ namespace grcube3
 		default: return false;
 		}
 
+		// Pieces that must be solved after the algorithm and the AUF (the start spin is restored, so the masks don't change)
+		S64 EMask, CMask, EMaskAux, CMaskAux;
+		if (!Cube::GetMasksSolved(MidLayer, EMask, CMask)) return false;
+		Cube::GetMasksSolved(DownLayerCorners, EMaskAux, CMaskAux);
+		EMask |= EMaskAux;
+		CMask |= CMaskAux;
+		Cube::GetMasksSolved(UpLayerCorners, EMaskAux, CMaskAux);
+		EMask |= EMaskAux;
+		CMask |= CMaskAux;
+		EMask |= Cube::GetMaskSolvedEdges({ Cube::PcpToEdp(Cube::FromAbsPosition(App::DR, CubeBase.GetSpin())),
+		                                    Cube::PcpToEdp(Cube::FromAbsPosition(App::DL, CubeBase.GetSpin())) });
+
 		bool LL_Found = false;
-        Spn Spin1, Spin2; // Cube spins before and after applying algorithm
+        const Spn Spin1 = CubeBase.GetSpin(); // Cube spin before applying algorithm (U movements don't change it)
+        Spn Spin2; // Cube spin after applying algorithm
         Stp StepS1, StepS2; // Steps to return cube to the start spin
 
+        // Cubes with each U movement before algorithm
+        CubeBatch CubesU, CubesLL;
+        for (const auto ULL1 : Algorithm::UMovs)
+        {
+            Cube CubeU = CubeBase;
+            CubeU.ApplyStep(ULL1);
+            CubesU.Add(CubeU);
+        }
+
         for (uint LL_Index = 0u; LL_Index < AlgSet.GetCasesNumber(); LL_Index++)
         {
             Algorithm Alg = AlgSet.GetAlgorithm(LL_Index, Pol, Met);
 
-            for (const auto ULL1: Algorithm::UMovs) // U movement before algorithm
+            CubesLL = CubesU;
+            CubesLL.Apply(CubeDelta(Alg, Spin1)); // Same effect for all U movements
+            Spin2 = CubesLL.GetSpin(0u);
+            if (Spin1 != Spin2) Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
+            else StepS1 = StepS2 = Stp::NONE;
+
+            for (uint U1 = 0u; U1 < CubesLL.GetSize(); U1++) // U movement before algorithm
             {
+                Cube CubeAlg = CubesLL.GetCube(U1);
+                if (StepS1 != Stp::NONE) CubeAlg.ApplyStep(StepS1);
+                if (StepS2 != Stp::NONE) CubeAlg.ApplyStep(StepS2);
+
                 for (const auto ULL2: Algorithm::UMovs) // U movement after algorithm (AUF)
                 {
-                    Cube CubeLL = CubeBase;
-                    CubeLL.ApplyStep(ULL1);
-                    Spin1 = CubeLL.GetSpin();
-                    CubeLL.ApplyAlgorithm(Alg);
-                    Spin2 = CubeLL.GetSpin();
-                    if (Spin1 != Spin2)
-                    {
-                        Cube::GetSpinsSteps(Spin2, Spin1, StepS1, StepS2);
-                        if (StepS1 != Stp::NONE) CubeLL.ApplyStep(StepS1);
-                        if (StepS2 != Stp::NONE) CubeLL.ApplyStep(StepS2);
-                    }
-                    else StepS1 = StepS2 = Stp::NONE;
+                    Cube CubeLL = CubeAlg;
                     CubeLL.ApplyStep(ULL2);
 
-                    LL_Found = CubeLL.IsSolved(DownLayerCorners) && CubeLL.IsSolved(MidLayer) && CubeLL.IsSolved(UpLayerCorners) &&
-                                CubeLL.IsSolved(Cube::FromAbsPosition(App::DR, CubeLL.GetSpin())) && 
-                                CubeLL.IsSolved(Cube::FromAbsPosition(App::DL, CubeLL.GetSpin()));
+                    LL_Found = CubeLL.IsSolved(EMask, CMask);
 
                     if (LL_Found && EdgesOriented) LL_Found = CubeLL.CheckOrientation(UpLayerEdges);
 
@@ -310,6 +341,7 @@ namespace grcube3
                     {
                         LLCase = AlgSet.GetCaseName(LL_Index);
 
+                        const Stp ULL1 = Algorithm::UMovs[U1];
                         if (ULL1 != Stp::NONE)
                         {
                             // LLSolve.Append(Stp::PARENTHESIS_OPEN);
@@ -2173,23 +2205,33 @@ namespace grcube3
         
         std::vector<std::pair<uint, Algorithm>> ScoredSolves;
 
-        for (const auto& s : Solves) // Check each solve to get the best one
+        // Cubes after each solve and the masks for the pieces groups to check in all of them
+        const CubeBatch Checked(CBase, Solves);
+        S64 CrossEMask, CrossCMask, F2LEMasks[4], F2LCMasks[4];
+        Cube::GetMasksSolved(CrossPG, CrossEMask, CrossCMask);
+        Cube::GetMasksSolved(F2L_1, F2LEMasks[0], F2LCMasks[0]);
+        Cube::GetMasksSolved(F2L_2, F2LEMasks[1], F2LCMasks[1]);
+        Cube::GetMasksSolved(F2L_3, F2LEMasks[2], F2LCMasks[2]);
+        Cube::GetMasksSolved(F2L_4, F2LEMasks[3], F2LCMasks[3]);
+
+        std::vector<uint8_t> CrossSolved;
+        if (CrossMandatory && Checked.CheckSolved(CrossSolved, CrossEMask, CrossCMask) == 0u) return false;
+
+        for (uint n = 0u; n < Checked.GetSize(); n++) // Check each solve to get the best one
         {
-            Score = 0u;
+            if (CrossMandatory && !CrossSolved[n]) continue;
 
-            Cube CheckCube = CBase;
-            CheckCube.ApplyAlgorithm(s);
+            const Algorithm& s = Solves[n];
 
-            if (CrossMandatory && !CheckCube.IsSolved(CrossPG)) continue;
+            Score = 0u;
 
             Score += (s.GetSize() > 50u ? 0u : 50u - s.GetSize()) * SolveSizeMagnitude;
             Score -= s.GetSubjectiveScore();
 
             // Check F2L solves
-            if (CheckCube.IsSolved(F2L_1)) Score += SolveF2LMagnitude;
-            if (CheckCube.IsSolved(F2L_2)) Score += SolveF2LMagnitude;
-            if (CheckCube.IsSolved(F2L_3)) Score += SolveF2LMagnitude;
-            if (CheckCube.IsSolved(F2L_4)) Score += SolveF2LMagnitude;
+            for (uint f = 0u; f < 4u; f++) if (Checked.IsSolved(n, F2LEMasks[f], F2LCMasks[f])) Score += SolveF2LMagnitude;
+
+            const Cube CheckCube = Checked.GetCube(n);
 
             // Check both F2L pieces condition in the opposite layer
             const Lyr EndLayer = Cube::OppositeLayer(StartLayer);
@@ -38,6 +38,7 @@ namespace grcube3
             Scramble = Scr;
             CubeBase = Cube(Scramble);
             Cores = NumCores;
+            DS.ResetStats(); // Search statistics only for this method
         }
 
 		virtual ~Method() { } // Virtual destructor to avoid warnings
@@ -60,7 +61,18 @@ namespace grcube3
         // If the first step is search externally, use this function to set the first step search depth
         virtual void SetDepthFS(uint) = 0;
 		
-		static uint* GetMaxDepthPointer() { return DS.GetMaxDepthPointer(); } // Get the static deep search maximum depth pointer
+		static std::atomic<uint>* GetMaxDepthPointer() { return DS.GetMaxDepthPointer(); } // Get the static deep search maximum depth pointer
+
+		// Limits for all the method searches (nullptr for no limits). When the budget is exhausted, the remaining searches are skipped
+		static void SetBudget(SearchBudget* B) { DS.SetBudget(B); }
+		static SearchBudget* GetBudget() { return DS.GetBudget(); }
+
+		// Some search was stopped by the budget, so the solves could be incomplete
+		static bool IsTruncated() { return DS.GetBudget() != nullptr && DS.GetBudget()->IsExhausted(); }
+
+		// Statistics for the method searches (empty report without GRCUBE3_SEARCH_STATS)
+		static const SearchStats& GetSearchStats() { return DS.GetStats(); }
+		static std::string GetSearchStatsReport() { return DS.GetStats().GetReport(); }
 
 		// Get search algorithms texts
         std::string GetTextScramble() const { return Scramble.ToString(); }
@@ -74,35 +74,7 @@ namespace grcube3
 		DS.Clear();
         DS.SetScramble(Scramble);
 		
-        DS.AddToOptionalPieces(Pgr::UF_B1);
-        DS.AddToOptionalPieces(Pgr::UB_B1);
-        DS.AddToOptionalPieces(Pgr::UR_B1);
-        DS.AddToOptionalPieces(Pgr::UL_B1);
-
-        DS.AddToOptionalPieces(Pgr::DF_B1);
-        DS.AddToOptionalPieces(Pgr::DB_B1);
-        DS.AddToOptionalPieces(Pgr::DR_B1);
-        DS.AddToOptionalPieces(Pgr::DL_B1);
-
-        DS.AddToOptionalPieces(Pgr::FU_B1);
-        DS.AddToOptionalPieces(Pgr::FD_B1);
-        DS.AddToOptionalPieces(Pgr::FR_B1);
-        DS.AddToOptionalPieces(Pgr::FL_B1);
-
-        DS.AddToOptionalPieces(Pgr::BU_B1);
-        DS.AddToOptionalPieces(Pgr::BD_B1);
-        DS.AddToOptionalPieces(Pgr::BR_B1);
-        DS.AddToOptionalPieces(Pgr::BL_B1);
-
-        DS.AddToOptionalPieces(Pgr::RU_B1);
-        DS.AddToOptionalPieces(Pgr::RD_B1);
-        DS.AddToOptionalPieces(Pgr::RF_B1);
-        DS.AddToOptionalPieces(Pgr::RB_B1);
-
-        DS.AddToOptionalPieces(Pgr::LU_B1);
-        DS.AddToOptionalPieces(Pgr::LD_B1);
-        DS.AddToOptionalPieces(Pgr::LF_B1);
-        DS.AddToOptionalPieces(Pgr::LB_B1);
+        DS.AddToOptionalPieces(Pgr::UF_B1, SearchSpins); // First block for each search spin, all in a single search
 
 		// First level is extended in the search to improve the multithreading - first level will not be checked
 		// (it's supose that the first block not will be solved in a single movement)
@@ -1141,6 +1113,7 @@ namespace grcube3
 
         Report += "Threads used: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
@@ -1027,6 +1027,7 @@ namespace grcube3
         Report += "Last layer time: " + std::to_string(GetTimeLL()) + " s\n";
         Report += "Threads: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
@@ -0,0 +1,190 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "pruning.h"
+
+namespace grcube3
+{
+	std::map<std::vector<uint>, std::unique_ptr<PruningTable>> PruningTable::Tables; // Initialize static variables
+	std::mutex PruningTable::TablesMutex;
+
+	// Build the pruning table for the given pieces with a breadth-first search from the solved state
+	PruningTable::PruningTable(const std::vector<uint>& TablePieces)
+	{
+		Pieces = TablePieces;
+
+		uint Size = 1u;
+		for (uint n = 0u; n < Pieces.size(); n++) Size *= 24u;
+		Distances.assign(Size, 0xFFu);
+
+		std::vector<const std::array<std::array<uint8_t, 24>, 18>*> Moves; // State changes for each piece in the table
+		for (const auto P : Pieces) Moves.push_back(P < 12u ? &GetEdgeMoves() : &GetCornerMoves());
+
+		PiecesState Solved;
+		Cube C;
+		GetPiecesState(C, Solved);
+		Distances[GetIndex(Solved)] = 0u;
+
+		std::vector<uint> Current = { GetIndex(Solved) }, Next; // Current and next depth states
+		std::vector<uint> Digits(Pieces.size());
+
+		for (uint8_t Depth = 1u; !Current.empty(); Depth++)
+		{
+			Next.clear();
+			for (const auto Index : Current)
+			{
+				uint Aux = Index;
+				for (auto& d : Digits) { d = Aux % 24u; Aux /= 24u; }
+
+				for (uint m = 0u; m < 18u; m++)
+				{
+					uint NewIndex = 0u;
+					for (uint p = static_cast<uint>(Pieces.size()); p-- > 0u;) NewIndex = NewIndex * 24u + (*Moves[p])[m][Digits[p]];
+					if (Distances[NewIndex] == 0xFFu)
+					{
+						Distances[NewIndex] = Depth;
+						Next.push_back(NewIndex);
+					}
+				}
+			}
+			Current.swap(Next);
+		}
+	}
+
+	// Get the number of face turns a step applies to the pieces
+	int PruningTable::GetStepTurns(const Stp S)
+	{
+		switch (Algorithm::GetRange(S))
+		{
+		case Rng::SINGLE:
+		case Rng::DOUBLE: return 1; // Wide movements are a face turn and a rotation
+		case Rng::INTERNAL: return 2; // Middle layer movements are two face turns and a rotation
+		case Rng::PARENTHESES: return S == Stp::PARENTHESIS_OPEN || S == Stp::PARENTHESIS_CLOSE_1_REP ? 0 : -1;
+		default: return 0;
+		}
+	}
+
+	// Get the current state of all pieces in the cube
+	void PruningTable::GetPiecesState(const Cube& C, PiecesState& PS)
+	{
+		const S64 E = C.GetEdgesStatus(), Cr = C.GetCornersStatus();
+
+		for (uint p = 0u; p < 12u; p++) // Four bits per edge position, direction bits from bit 48
+			PS[(E >> (4u * p)) & 0xFu] = static_cast<uint8_t>(p * 2u + ((E >> (48u + p)) & 0x1u));
+
+		for (uint p = 0u; p < 8u; p++) // Eight bits per corner position, three for the corner and two for the direction
+			PS[12u + ((Cr >> (8u * p)) & 0x7u)] = static_cast<uint8_t>(p * 3u + ((Cr >> (8u * p + 4u)) & 0x3u));
+	}
+
+	// Get the table for the given pieces (built if it's not already built)
+	const PruningTable* PruningTable::GetTable(const std::vector<uint>& TablePieces)
+	{
+		std::lock_guard<std::mutex> guard(TablesMutex); // Thread safe code
+		auto& T = Tables[TablePieces];
+		if (T == nullptr) T.reset(new PruningTable(TablePieces));
+		return T.get();
+	}
+
+	// State changes for edges
+	const std::array<std::array<uint8_t, 24>, 18>& PruningTable::GetEdgeMoves()
+	{
+		static const std::array<std::array<uint8_t, 24>, 18> EdgeMoves = BuildMoves(true);
+		return EdgeMoves;
+	}
+
+	// State changes for corners
+	const std::array<std::array<uint8_t, 24>, 18>& PruningTable::GetCornerMoves()
+	{
+		static const std::array<std::array<uint8_t, 24>, 18> CornerMoves = BuildMoves(false);
+		return CornerMoves;
+	}
+
+	// Get the state changes for the face turns following a single piece (FR edge or UFR corner) through all his states
+	// The changes depends only on the piece state, so they are valid for all pieces of the same type
+	std::array<std::array<uint8_t, 24>, 18> PruningTable::BuildMoves(const bool Edges)
+	{
+		const uint Piece = Edges ? 0u : 12u;
+
+		std::array<Cube, 24> Samples; // A cube for each state of the piece
+		std::array<bool, 24> Found;
+		Found.fill(false);
+
+		PiecesState PS;
+		Cube C;
+		GetPiecesState(C, PS);
+		Samples[PS[Piece]] = C;
+		Found[PS[Piece]] = true;
+
+		std::vector<uint8_t> Pending = { PS[Piece] };
+		while (!Pending.empty())
+		{
+			const uint8_t S = Pending.back();
+			Pending.pop_back();
+			for (uint m = 0u; m < 18u; m++)
+			{
+				Cube C2 = Samples[S];
+				C2.ApplyStep(static_cast<Stp>(static_cast<uint>(Stp::U) + m));
+				GetPiecesState(C2, PS);
+				if (!Found[PS[Piece]])
+				{
+					Found[PS[Piece]] = true;
+					Samples[PS[Piece]] = C2;
+					Pending.push_back(PS[Piece]);
+				}
+			}
+		}
+
+		std::array<std::array<uint8_t, 24>, 18> Moves;
+		for (uint m = 0u; m < 18u; m++)
+		{
+			for (uint8_t S = 0u; S < 24u; S++)
+			{
+				Cube C2 = Samples[S];
+				C2.ApplyStep(static_cast<Stp>(static_cast<uint>(Stp::U) + m));
+				GetPiecesState(C2, PS);
+				Moves[m][S] = PS[Piece];
+			}
+		}
+		return Moves;
+	}
+
+	// Set the masks pair: pieces are divided in groups of PruningTable::MaxPieces pieces, with a table for each group
+	void PruningBound::Set(const S64 EMask, const S64 CMask)
+	{
+		Tables.clear();
+
+		std::vector<uint> Group;
+		for (uint p = 0u; p < 20u; p++)
+		{
+			const S64 PieceMask = p < 12u ? Cube::GetMaskSolvedEdge(static_cast<Edp>(p)) : Cube::GetMaskSolvedCorner(static_cast<Cnp>(p - 12u));
+			if (((p < 12u ? EMask : CMask) & PieceMask) != PieceMask) continue; // Only pieces fully in the mask
+
+			Group.push_back(p);
+			if (Group.size() == PruningTable::MaxPieces)
+			{
+				Tables.push_back(PruningTable::GetTable(Group));
+				Group.clear();
+			}
+		}
+		if (!Group.empty()) Tables.push_back(PruningTable::GetTable(Group));
+	}
+}
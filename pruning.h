@@ -0,0 +1,109 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+#include "cube.h"
+
+namespace grcube3
+{
+	// Current state of each piece (edges 0 to 11, corners 12 to 19), as position * directions + direction (0 to 23)
+	typedef std::array<uint8_t, 20> PiecesState;
+
+	// Pruning table (pattern database) for a small group of pieces: minimum number of face turns needed to solve them
+	class PruningTable
+	{
+	public:
+		static constexpr uint MaxPieces = 4u; // Maximum number of pieces in a table (24^4 entries)
+
+		// Build the table for the given pieces (edges 0 to 11, corners 12 to 19)
+		PruningTable(const std::vector<uint>&);
+
+		// Get the minimum number of face turns needed to solve the pieces
+		uint GetDistance(const PiecesState& PS) const { return Distances[GetIndex(PS)]; }
+
+		// Get the number of face turns a step applies to the pieces (rotations don't move pieces, middle layers are two face turns)
+		// Parentheses with repetitions have no fixed number of turns, returns -1
+		static int GetStepTurns(const Stp);
+
+		// Get the current state of all pieces in the cube
+		static void GetPiecesState(const Cube&, PiecesState&);
+
+		// Get the table for the given pieces (tables are built only once and shared by all the searches)
+		static const PruningTable* GetTable(const std::vector<uint>&);
+
+	private:
+		std::vector<uint> Pieces; // Pieces in the table
+		std::vector<uint8_t> Distances; // Face turns to solve the pieces for each state
+
+		// Get the table index for the pieces state (a base 24 digit for each piece)
+		uint GetIndex(const PiecesState& PS) const
+		{
+			uint Index = 0u;
+			for (auto p = Pieces.rbegin(); p != Pieces.rend(); p++) Index = Index * 24u + PS[*p];
+			return Index;
+		}
+
+		// Get the piece state changes for each face turn (18 turns x 24 states) for edges and corners
+		static const std::array<std::array<uint8_t, 24>, 18>& GetEdgeMoves();
+		static const std::array<std::array<uint8_t, 24>, 18>& GetCornerMoves();
+		static std::array<std::array<uint8_t, 24>, 18> BuildMoves(const bool);
+
+		static std::map<std::vector<uint>, std::unique_ptr<PruningTable>> Tables; // Built tables
+		static std::mutex TablesMutex; // Mutex for the built tables
+	};
+
+	// Lower bound of the face turns needed to solve the pieces in a masks pair (the maximum of the pruning tables for the pieces groups)
+	// Only pieces with full masks (position and direction) are used, a pair with no full pieces has no bound (zero)
+	class PruningBound
+	{
+	public:
+		PruningBound() {}
+		PruningBound(const S64 EMask, const S64 CMask) { Set(EMask, CMask); }
+
+		void Set(const S64, const S64); // Set the masks pair (tables are built if needed)
+		void Clear() { Tables.clear(); }
+		bool Empty() const { return Tables.empty(); }
+
+		// Get the lower bound for the pieces state
+		uint GetBound(const PiecesState& PS) const
+		{
+			uint Bound = 0u;
+			for (const auto T : Tables)
+			{
+				const uint D = T->GetDistance(PS);
+				if (D > Bound) Bound = D;
+			}
+			return Bound;
+		}
+
+	private:
+		std::vector<const PruningTable*> Tables; // Tables for the groups of pieces
+	};
+}
@@ -62,35 +62,7 @@ namespace grcube3
 		DS.Clear();
         DS.SetScramble(Scramble);
 		
-        DS.AddToOptionalPieces(Pgr::UF_B1);
-        DS.AddToOptionalPieces(Pgr::UB_B1);
-        DS.AddToOptionalPieces(Pgr::UR_B1);
-        DS.AddToOptionalPieces(Pgr::UL_B1);
-
-        DS.AddToOptionalPieces(Pgr::DF_B1);
-        DS.AddToOptionalPieces(Pgr::DB_B1);
-        DS.AddToOptionalPieces(Pgr::DR_B1);
-        DS.AddToOptionalPieces(Pgr::DL_B1);
-
-        DS.AddToOptionalPieces(Pgr::FU_B1);
-        DS.AddToOptionalPieces(Pgr::FD_B1);
-        DS.AddToOptionalPieces(Pgr::FR_B1);
-        DS.AddToOptionalPieces(Pgr::FL_B1);
-
-        DS.AddToOptionalPieces(Pgr::BU_B1);
-        DS.AddToOptionalPieces(Pgr::BD_B1);
-        DS.AddToOptionalPieces(Pgr::BR_B1);
-        DS.AddToOptionalPieces(Pgr::BL_B1);
-
-        DS.AddToOptionalPieces(Pgr::RU_B1);
-        DS.AddToOptionalPieces(Pgr::RD_B1);
-        DS.AddToOptionalPieces(Pgr::RF_B1);
-        DS.AddToOptionalPieces(Pgr::RB_B1);
-
-        DS.AddToOptionalPieces(Pgr::LU_B1);
-        DS.AddToOptionalPieces(Pgr::LD_B1);
-        DS.AddToOptionalPieces(Pgr::LF_B1);
-        DS.AddToOptionalPieces(Pgr::LB_B1);
+        DS.AddToOptionalPieces(Pgr::UF_B1, SearchSpins); // First block for each search spin, all in a single search
 
 		// First level is extended in the search to improve the multithreading - first level will not be checked
 		// (it's supose that the first block not will be solved in a single movement)
@@ -111,6 +83,8 @@ namespace grcube3
         DS.AddSearchLevel(L_Check); // Level 3
         for (uint l = 4u; l < MaxDepthFB; l++) DS.AddSearchLevel(L_Check); // Levels 4 to MaxDepth
 
+        DS.SetPruning(); // Skip the branches that can't reach any solve
+        DS.SetMeetInTheMiddle(); // Join forward and backward halves of the search when possible
         DS.UpdateRootData();
 		// DS.SetMinDepth(DS.GetMaxDepth() - 2u);
 
@@ -494,6 +468,7 @@ namespace grcube3
 
 				// Auxiliar deep search for last six edges in 3 movements (very fast)
 				DeepSearch PreDSL6E(AlgStart, Plc::SHORT);
+				PreDSL6E.SetBudget(DS.GetBudget()); // Same limits as the method searches
 				PreDSL6E.AddToMandatoryPieces(Pgr::ALL); // Search the full cube
 				PreDSL6E.AddSearchLevel(L_Check);
 				PreDSL6E.AddSearchLevel(L_Check);
@@ -891,6 +866,7 @@ namespace grcube3
         Report += "L6E time: " + std::to_string(GetTimeL6E() + GetTimeL6EO() + GetTimeL6E2E()) + " s\n";
         Report += "Threads: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }
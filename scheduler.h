@@ -0,0 +1,187 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include "cube_definitions.h"
+
+namespace grcube3
+{
+	// Work-stealing scheduler for the tree searches
+	// Each thread has his own tasks queue: the owner takes the newest task (depth first), idle threads steal the oldest
+	// task (usually the biggest subtree) from other queues. Running tasks can split their subtrees into new tasks when
+	// some thread is hungry (see IsHungry)
+	template <class Task>
+	class WorkStealingScheduler
+	{
+	public:
+		// Scheduler constructor with the number of threads
+		WorkStealingScheduler(const uint NumThreads)
+		{
+			Threads = NumThreads == 0u ? 1u : NumThreads;
+			Queues = std::vector<TaskQueue>(Threads);
+			BusyTime.assign(Threads, 0.0);
+			IdleTime.assign(Threads, 0.0);
+			Pending = 0u;
+			Queued = 0u;
+			Hungry = 0u;
+		}
+
+		uint GetThreads() const { return Threads; } // Get the number of threads
+
+		// Add a task to the given thread queue
+		void Push(const uint Thread, const Task& T)
+		{
+			Pending++;
+			{
+				std::lock_guard<std::mutex> guard(Queues[Thread].Mutex);
+				Queues[Thread].Tasks.push_back(T);
+			}
+			Queued++;
+			if (Hungry.load() > 0u) Notify(false); // Wake up an idle thread
+		}
+
+		// Returns true if there is at least an idle thread waiting for a task (running tasks should split)
+		bool IsHungry() const { return Hungry.load(std::memory_order_relaxed) > 0u; }
+
+		// Run all the tasks; Work is called as Work(ThreadIndex, Task&) and can push new tasks
+		// If UseThreads is false all the tasks are run in the calling thread
+		template <class F>
+		void Run(F Work, const bool UseThreads = true)
+		{
+			if (UseThreads && Threads > 1u)
+			{
+				std::vector<std::thread> Pool; // Threads pool
+				for (uint t = 0u; t < Threads; t++) Pool.push_back(std::thread(&WorkStealingScheduler::Worker<F>, this, t, std::ref(Work)));
+				for (auto& t : Pool) t.join(); // Wait for all threads
+			}
+			else for (uint t = 0u; t < Threads; t++) Worker(t, Work); // Each queue is consumed in order
+		}
+
+		double GetBusyTime(const uint t) const { return BusyTime[t]; } // Time used by given thread running tasks
+		double GetIdleTime(const uint t) const { return IdleTime[t]; } // Time used by given thread waiting for tasks
+		const std::vector<double>& GetBusyTimes() const { return BusyTime; } // Times used by threads running tasks
+		const std::vector<double>& GetIdleTimes() const { return IdleTime; } // Times used by threads waiting for tasks
+
+	private:
+
+		// Tasks queue for a thread
+		struct TaskQueue
+		{
+			std::deque<Task> Tasks;
+			std::mutex Mutex;
+
+			TaskQueue() {}
+			TaskQueue(const TaskQueue&) {} // Mutex can't be copied, only empty queues are copied
+		};
+
+		uint Threads; // Number of threads
+		std::vector<TaskQueue> Queues; // A tasks queue per thread
+		std::atomic<uint> Pending; // Tasks queued or running
+		std::atomic<uint> Queued; // Tasks queued
+		std::atomic<uint> Hungry; // Threads without task
+		std::vector<double> BusyTime, IdleTime; // Busy and idle time per thread
+		std::mutex WaitMutex; // Mutex for the idle threads wait
+		std::condition_variable WaitCondition; // Idle threads wait for a new task or for the end of all tasks
+
+		// Wake up the idle threads (the mutex is locked so a thread that is going to wait can't miss the notification)
+		void Notify(const bool All)
+		{
+			{ std::lock_guard<std::mutex> guard(WaitMutex); }
+			if (All) WaitCondition.notify_all();
+			else WaitCondition.notify_one();
+		}
+
+		// Get a task for the given thread: first from his own queue (newest task), else steal from other queues (oldest task)
+		bool GetTask(const uint Thread, Task& T)
+		{
+			{
+				std::lock_guard<std::mutex> guard(Queues[Thread].Mutex);
+				if (!Queues[Thread].Tasks.empty())
+				{
+					T = Queues[Thread].Tasks.back();
+					Queues[Thread].Tasks.pop_back();
+					Queued--;
+					return true;
+				}
+			}
+
+			for (uint n = 1u; n < Threads; n++)
+			{
+				TaskQueue& Q = Queues[(Thread + n) % Threads];
+				std::lock_guard<std::mutex> guard(Q.Mutex);
+				if (!Q.Tasks.empty())
+				{
+					T = Q.Tasks.front();
+					Q.Tasks.pop_front();
+					Queued--;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Thread main loop
+		template <class F>
+		void Worker(const uint Thread, F& Work)
+		{
+			Task T;
+			auto Start = std::chrono::steady_clock::now();
+			bool IsIdle = false;
+
+			while (true)
+			{
+				if (GetTask(Thread, T))
+				{
+					const auto TaskStart = std::chrono::steady_clock::now();
+					if (IsIdle) { Hungry--; IsIdle = false; }
+					IdleTime[Thread] += std::chrono::duration<double>(TaskStart - Start).count();
+
+					Work(Thread, T);
+					if (--Pending == 0u) Notify(true); // All tasks done, wake up the idle threads for exit
+
+					Start = std::chrono::steady_clock::now();
+					BusyTime[Thread] += std::chrono::duration<double>(Start - TaskStart).count();
+				}
+				else if (Pending.load() == 0u) break; // All tasks done
+				else
+				{
+					if (!IsIdle) { Hungry++; IsIdle = true; }
+					std::unique_lock<std::mutex> lock(WaitMutex); // Wait for a new task or for the end of all tasks
+					WaitCondition.wait(lock, [this] { return Queued.load() > 0u || Pending.load() == 0u; });
+				}
+			}
+
+			if (IsIdle) Hungry--;
+			IdleTime[Thread] += std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+		}
+	};
+}
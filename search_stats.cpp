@@ -0,0 +1,95 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "search_stats.h"
+
+namespace grcube3
+{
+	// Add the statistics of other searches (from other deep search objects)
+	void SearchStats::Add(const SearchStats& S)
+	{
+		if (!Enabled) return;
+		Prepare(S.GetThreads(), S.GetLevels());
+		for (uint t = 0u; t < S.GetThreads(); t++)
+		{
+			for (uint l = 0u; l < S.Counters[t].size(); l++)
+				for (uint c = 0u; c < static_cast<uint>(Sts::SIZE); c++) Counters[t][l][c] += S.Counters[t][l][c];
+			if (t < S.ThreadsTime.size()) ThreadsTime[t] += S.ThreadsTime[t];
+		}
+		Time += S.Time;
+		Searches += S.Searches;
+	}
+
+	// Counter for a thread and level
+	uint64_t SearchStats::Get(const uint Thread, const uint Level, const Sts S) const
+	{
+		if (Thread >= Counters.size() || Level >= Counters[Thread].size()) return 0u;
+		return Counters[Thread][Level][static_cast<int>(S)];
+	}
+
+	// Counter for a level (all threads)
+	uint64_t SearchStats::GetLevel(const uint Level, const Sts S) const
+	{
+		uint64_t n = 0u;
+		for (uint t = 0u; t < GetThreads(); t++) n += Get(t, Level, S);
+		return n;
+	}
+
+	// Counter for a thread (all levels)
+	uint64_t SearchStats::GetThread(const uint Thread, const Sts S) const
+	{
+		uint64_t n = 0u;
+		for (uint l = 0u; l < GetLevels(); l++) n += Get(Thread, l, S);
+		return n;
+	}
+
+	// Counter for all levels and threads
+	uint64_t SearchStats::GetTotal(const Sts S) const
+	{
+		uint64_t n = 0u;
+		for (uint l = 0u; l < GetLevels(); l++) n += GetLevel(l, S);
+		return n;
+	}
+
+	// Statistics report, a line for each level and a line for each thread
+	std::string SearchStats::GetReport() const
+	{
+		if (!Enabled || Searches == 0u) return "";
+
+		std::string Report = "Search statistics: " + std::to_string(Searches) + " searches, " + std::to_string(Time) + " s\n";
+
+		for (uint l = 0u; l < GetLevels(); l++)
+		{
+			Report += "Level " + std::to_string(l + 1u) + ": " + std::to_string(GetLevel(l, Sts::NODES)) + " nodes, " +
+					  std::to_string(GetLevel(l, Sts::CHECKS)) + " checks, " + std::to_string(GetLevel(l, Sts::MASK_HITS)) + " mask hits, " +
+					  std::to_string(GetLevel(l, Sts::SOLVES)) + " solves, " + std::to_string(GetLevel(l, Sts::CUTOFFS)) + " cutoffs\n";
+		}
+
+		for (uint t = 0u; t < GetThreads(); t++)
+		{
+			Report += "Thread " + std::to_string(t + 1u) + ": " + std::to_string(GetThread(t, Sts::NODES)) + " nodes, " +
+					  std::to_string(GetThread(t, Sts::SOLVES)) + " solves, " + std::to_string(GetThreadTime(t)) + " s\n";
+		}
+
+		return Report;
+	}
+}
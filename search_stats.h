@@ -0,0 +1,109 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+#include <array>
+#include <string>
+#include <cstdint>
+
+#include "cube_definitions.h"
+
+namespace grcube3
+{
+	// Counters for the search statistics
+	enum class Sts
+	{
+		NODES, // Search nodes expanded
+		CHECKS, // Solve checks
+		MASK_HITS, // Checks that passed the mandatory masks
+		SOLVES, // Solves recorded
+		CUTOFFS, // Branches cut by the pruning tables
+		SIZE // Number of counters
+	};
+
+	// Statistics for the searches, per level and per thread (define GRCUBE3_SEARCH_STATS to enable them)
+	// Each thread only updates his own counters, so no locks are needed. Without GRCUBE3_SEARCH_STATS all the counting
+	// code is removed by the compiler and the reports are empty
+	class SearchStats
+	{
+	public:
+#ifdef GRCUBE3_SEARCH_STATS
+		static const bool Enabled = true;
+#else
+		static const bool Enabled = false;
+#endif
+
+		SearchStats() { Reset(); }
+
+		// Clear all the statistics
+		void Reset() { Counters.clear(); ThreadsTime.clear(); Time = 0.0; Searches = 0u; }
+
+		// Make room for a new search with the given threads and levels (before the search threads start)
+		void Prepare(const uint Threads, const uint Levels)
+		{
+			if (!Enabled) return;
+			if (Counters.size() < Threads) Counters.resize(Threads);
+			for (auto& TC : Counters) if (TC.size() < Levels) TC.resize(Levels, LevelCounters());
+			if (ThreadsTime.size() < Threads) ThreadsTime.resize(Threads, 0.0);
+		}
+
+		// Count an event in the given thread and level
+		void Count(const uint Thread, const uint Level, const Sts S)
+		{
+			if (Enabled && Level < Counters[Thread].size()) Counters[Thread][Level][static_cast<int>(S)]++;
+		}
+
+		// Add the times of a completed search (busy time for each thread and total time)
+		void AddTimes(const std::vector<double>& Busy, const double Total)
+		{
+			if (!Enabled) return;
+			for (uint t = 0u; t < Busy.size() && t < ThreadsTime.size(); t++) ThreadsTime[t] += Busy[t];
+			Time += Total;
+			Searches++;
+		}
+
+		void Add(const SearchStats&); // Add the statistics of other searches (from other deep search objects)
+
+		uint GetThreads() const { return static_cast<uint>(Counters.size()); }
+		uint GetLevels() const { return Counters.empty() ? 0u : static_cast<uint>(Counters[0].size()); }
+		uint GetSearches() const { return Searches; } // Number of searches added to the statistics
+		double GetTime() const { return Time; } // Total time for the searches
+		double GetThreadTime(const uint t) const { return t < ThreadsTime.size() ? ThreadsTime[t] : 0.0; } // Busy time for a thread
+
+		uint64_t Get(const uint Thread, const uint Level, const Sts S) const; // Counter for a thread and level
+		uint64_t GetLevel(const uint Level, const Sts S) const; // Counter for a level (all threads)
+		uint64_t GetThread(const uint Thread, const Sts S) const; // Counter for a thread (all levels)
+		uint64_t GetTotal(const Sts S) const; // Counter for all levels and threads
+
+		std::string GetReport() const; // Statistics report (empty if the statistics are disabled)
+
+	private:
+		typedef std::array<uint64_t, static_cast<int>(Sts::SIZE)> LevelCounters;
+
+		std::vector<std::vector<LevelCounters>> Counters; // Counters for each thread and level
+		std::vector<double> ThreadsTime; // Busy time for each thread (seconds)
+		double Time; // Total time for the searches (seconds)
+		uint Searches; // Number of searches
+	};
+}
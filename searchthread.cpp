@@ -114,10 +114,11 @@ void RunSearch::startSearchCFOP(const QString Scr, const int NumCores, const int
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth && !c.Solves.empty())
             {
                 emit msgCache();
                 SearchCFOP->EvaluateCrosses(c.Solves, Inspections);
@@ -157,7 +158,8 @@ void RunSearch::startSearchCFOP(const QString Scr, const int NumCores, const int
 			if (!BaseSearch.CheckSkipSearch())
 			{
 				CacheUnit CU;
-				CU.Scramble = Scramble;
+				CU.Key = CubeScramble.GetKey();
+				CU.Spin = CubeScramble.GetSpin();
 				CU.Depth = Depth;
 				CU.Time = SearchCFOP->GetTime();
 				CU.Solves = BaseSearch.GetSolves();
@@ -266,10 +268,11 @@ void RunSearch::startSearchRoux(const QString Scr, const int NumCores, const int
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth1 && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth1 && !c.Solves.empty())
             {
                 emit msgCache();
                 SearchRoux->EvaluateFirstBlock(c.Solves, Inspections);
@@ -308,7 +311,8 @@ void RunSearch::startSearchRoux(const QString Scr, const int NumCores, const int
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth1;
                 CU.Time = SearchRoux->GetTimeFB();
                 CU.Solves = BaseSearch.GetSolves();
@@ -430,10 +434,11 @@ void RunSearch::startSearchPetrus(const QString Scr, const int NumCores, const i
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth1 && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth1 && !c.Solves.empty())
             {
                 emit msgCache();
                 SearchPetrus->EvaluateBlock(c.Solves, Inspections);
@@ -472,7 +477,8 @@ void RunSearch::startSearchPetrus(const QString Scr, const int NumCores, const i
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth1;
                 CU.Time = SearchPetrus->GetTimeBlock();
                 CU.Solves = BaseSearch.GetSolves();
@@ -592,10 +598,11 @@ void RunSearch::startSearchZZ(const QString Scr, const int NumCores, const int B
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-          if (c.Scramble == Scramble && c.Depth >= Depth && !c.Solves.empty())
+          if (c.IsFor(CubeScramble) && c.Depth >= Depth && !c.Solves.empty())
           {
               emit msgCache();
               SearchZZ->EvaluateEOX(c.Solves, Inspections);
@@ -634,7 +641,8 @@ void RunSearch::startSearchZZ(const QString Scr, const int NumCores, const int B
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth;
                 CU.Time = SearchZZ->GetTimeEOX();
                 CU.Solves = BaseSearch.GetSolves();
@@ -741,10 +749,11 @@ void RunSearch::startSearchCEOR(const QString Scr, const int NumCores, const int
         emit msgCEORStartLines();
         if (CacheEnabled)
         {
+            const Cube CubeScramble(Scramble);
             bool found = false;
             for (const auto& c : Cache) // Search in cache
             {
-              if (c.Scramble == Scramble && c.Depth >= 6u && !c.Solves.empty())
+              if (c.IsFor(CubeScramble) && c.Depth >= 6u && !c.Solves.empty())
               {
                   emit msgCache();
                   SearchYruRU->EvaluateLines(c.Solves, Inspections);
@@ -783,7 +792,8 @@ void RunSearch::startSearchCEOR(const QString Scr, const int NumCores, const int
                 if (!BaseSearch.CheckSkipSearch())
                 {
                     CacheUnit CU;
-                    CU.Scramble = Scramble;
+                    CU.Key = CubeScramble.GetKey();
+                    CU.Spin = CubeScramble.GetSpin();
                     CU.Depth = 6u;
                     CU.Time = SearchYruRU->GetTimeLines();
                     CU.Solves = BaseSearch.GetSolves();
@@ -819,10 +829,11 @@ void RunSearch::startSearchCEOR(const QString Scr, const int NumCores, const int
 
         if (CacheEnabled)
         {
+            const Cube CubeScramble(Scramble);
             bool found = false;
             for (const auto& c : Cache) // Search in cache
             {
-                if (c.Scramble == Scramble && c.Depth >= 6u && !c.Solves.empty())
+                if (c.IsFor(CubeScramble) && c.Depth >= 6u && !c.Solves.empty())
                 {
                     emit msgCache();
                     SearchYruRU->EvaluateCPLines(c.Solves, Inspections);
@@ -858,7 +869,8 @@ void RunSearch::startSearchCEOR(const QString Scr, const int NumCores, const int
                 if (!BaseSearch.CheckSkipSearch())
                 {
                     CacheUnit CU;
-                    CU.Scramble = Scramble;
+                    CU.Key = CubeScramble.GetKey();
+                    CU.Spin = CubeScramble.GetSpin();
                     CU.Depth = 6u;
                     CU.Time = SearchYruRU->GetTimeCPLines();
                     CU.Solves = BaseSearch.GetSolves();
@@ -967,10 +979,11 @@ void RunSearch::startSearchMehta(const QString Scr, const int NumCores, const in
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth1 && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth1 && !c.Solves.empty())
             {
                 emit msgCache();
                 SearchMehta->EvaluateFB(c.Solves, Inspections);
@@ -1006,7 +1019,8 @@ void RunSearch::startSearchMehta(const QString Scr, const int NumCores, const in
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth1;
                 CU.Time = SearchMehta->GetTimeFB();
                 CU.Solves = BaseSearch.GetSolves();
@@ -1152,10 +1166,11 @@ void RunSearch::startSearchNautilus(const QString Scr, const int NumCores, const
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth1 && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth1 && !c.Solves.empty())
             {
                 emit msgCache();
                 SearchNautilus->EvaluateFB(c.Solves, Inspections);
@@ -1191,7 +1206,8 @@ void RunSearch::startSearchNautilus(const QString Scr, const int NumCores, const
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth1;
                 CU.Time = SearchNautilus->GetTimeFB();
                 CU.Solves = BaseSearch.GetSolves();
@@ -1367,10 +1383,11 @@ void RunSearch::startSearchLEOR(const QString Scr, const int NumCores, const int
 
     if (CacheEnabled)
     {
+        const Cube CubeScramble(Scramble);
         bool found = false;
         for (const auto& c : Cache) // Search in cache
         {
-            if (c.Scramble == Scramble && c.Depth >= Depth1 && !c.Solves.empty())
+            if (c.IsFor(CubeScramble) && c.Depth >= Depth1 && !c.Solves.empty())
             {
                 emit msgCache();
                 if (VariantIndex == 1) SearchLEOR->EvaluateFBB(c.Solves, Inspections);
@@ -1408,7 +1425,8 @@ void RunSearch::startSearchLEOR(const QString Scr, const int NumCores, const int
             if (!BaseSearch.CheckSkipSearch())
             {
                 CacheUnit CU;
-                CU.Scramble = Scramble;
+                CU.Key = CubeScramble.GetKey();
+                CU.Spin = CubeScramble.GetSpin();
                 CU.Depth = Depth1;
                 CU.Time = SearchLEOR->GetTimeFB();
                 CU.Solves = BaseSearch.GetSolves();
@@ -3,7 +3,10 @@
 
 #include <QThread>
 
+#include <atomic>
+
 #include "algorithm.h"
+#include "cube.h"
 
 using namespace grcube3;
 
@@ -27,7 +30,12 @@ public:
        t.wait();
    }
 
-   void Skip() { if (CurrentSearchMaxDepthPointer != nullptr) *CurrentSearchMaxDepthPointer = 0u; }
+   // Stop the current search (called from other threads)
+   void Skip()
+   {
+       std::atomic<uint>* MaxDepthPointer = CurrentSearchMaxDepthPointer;
+       if (MaxDepthPointer != nullptr) MaxDepthPointer->store(0u, std::memory_order_relaxed);
+   }
 
    // Layer by layer search
    void doStartSearchLBL(const QString Scramble, const int CrossLayerIndex, const int NumCores, const int MetricIndex)
@@ -372,19 +380,23 @@ signals:
 private:
    QThread t;
 
-    uint* CurrentSearchMaxDepthPointer;
+    std::atomic<std::atomic<uint>*> CurrentSearchMaxDepthPointer; // Maximum depth of the current search (set to zero to stop it)
 
     bool FinishingThread;
 
    // Information to store about a solve search for the cache
    struct CacheUnit
    {
-       Algorithm Scramble;
+       CubeKey Key; // Scrambled cube status (the solves are valid for any scramble with the same status)
+       Spn Spin;
        uint Depth;
        double Time;
        std::vector<Algorithm> Solves;
 
-       void Reset() { Scramble.Clear(); Depth = 0u; Time = 0.0; Solves.clear(); }
+       void Reset() { Key = Cube().GetKey(); Spin = Spn::Default; Depth = 0u; Time = 0.0; Solves.clear(); }
+
+       // Check if the solves are for the given scrambled cube
+       bool IsFor(const Cube& C) const { return Key == C.GetKey() && Spin == C.GetSpin(); }
    };
 
    std::vector<CacheUnit> Cache; // Solves cache
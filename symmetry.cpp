@@ -0,0 +1,163 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include "symmetry.h"
+
+namespace grcube3
+{
+	// Edges direction changes for each spin
+	const uint16_t Symmetry::e_Flips[24] =
+	{
+		0x000u, 0x00Fu, 0x000u, 0x00Fu, 0x000u, 0x00Fu, 0x000u, 0x00Fu, // UF, UR, UB, UL, DF, DR, DB, DL
+		0x550u, 0x00Fu, 0x550u, 0x00Fu, 0x550u, 0x00Fu, 0x550u, 0x00Fu, // FU, FR, FD, FL, BU, BR, BD, BL
+		0x550u, 0x000u, 0x550u, 0x000u, 0x550u, 0x000u, 0x550u, 0x000u  // RU, RF, RD, RB, LU, LF, LD, LB
+	};
+
+	// Corners twist changes for each spin (twist for UFL, UBR, DFR and DBL positions)
+	const uint8_t Symmetry::c_Twists[24] =
+	{
+		0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, // UF, UR, UB, UL, DF, DR, DB, DL
+		1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, // FU, FR, FD, FL, BU, BR, BD, BL
+		2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u  // RU, RF, RD, RB, LU, LF, LD, LB
+	};
+
+	// Left-right mirror for the face turns
+	const Stp Symmetry::stp_Mirror[19] =
+	{
+		Stp::NONE,
+		Stp::Up, Stp::U, Stp::U2, Stp::Dp, Stp::D, Stp::D2,
+		Stp::Fp, Stp::F, Stp::F2, Stp::Bp, Stp::B, Stp::B2,
+		Stp::Lp, Stp::L, Stp::L2, Stp::Rp, Stp::R, Stp::R2
+	};
+
+	// Corners twist for each direction (first index: 1 for corner positions UFR, UBL, DFL and DBR, else 0)
+	// Also twist to direction, as the conversion is its own inverse
+	static const uint s_Twists[2][3] = { { 0u, 2u, 1u }, { 0u, 1u, 2u } };
+
+	// Corner positions UFR, UBL, DFL and DBR
+	static const uint s_Tetrad[8] = { 1u, 0u, 1u, 0u, 0u, 1u, 0u, 1u };
+
+	// Get the symmetric face turn
+	Stp Symmetry::GetStep(const uint Sym, const Stp S)
+	{
+		if (S > Stp::L2) return S; // Not a face turn
+		return Cube::GetAbsolutTurn(IsMirror(Sym) ? stp_Mirror[static_cast<int>(S)] : S, GetSpin(Sym));
+	}
+
+	// Get the symmetric algorithm
+	Algorithm Symmetry::GetAlgorithm(const uint Sym, const Algorithm& A)
+	{
+		Algorithm SymA;
+		for (uint n = 0u; n < A.GetSize(); n++) SymA.Append(GetStep(Sym, A.At(n)));
+		return SymA;
+	}
+
+	// Conjugate the edges and corners status with the symmetry
+	// Each piece moves to the symmetric position and changes to the symmetric piece; the directions change with the
+	// position and with the piece, so solved pieces remain solved
+	void Symmetry::Conjugate(const uint Sym, S64& Edges, S64& Corners)
+	{
+		const SymmetryData& SD = GetData()[Sym];
+		S64 E = 0u, C = 0u;
+
+		for (uint p = 0u; p < 12u; p++)
+		{
+			const uint Pos = SD.Edges[p], Edge = SD.Edges[(Edges >> (4u * p)) & 0xFu];
+			const S64 Dir = ((Edges >> (48u + p)) ^ SD.Flips[Pos] ^ SD.Flips[Edge]) & 0x1u;
+			E |= (static_cast<S64>(Edge) << (4u * Pos)) | (Dir << (48u + Pos));
+		}
+
+		for (uint p = 0u; p < 8u; p++)
+		{
+			const uint Pos = SD.Corners[p], Corner = SD.Corners[(Corners >> (8u * p)) & 0x7u];
+			uint Twist = s_Twists[s_Tetrad[p]][(Corners >> (8u * p + 4u)) & 0x3u];
+			if (SD.Mirror) Twist = (3u - Twist) % 3u;
+			Twist = (Twist + SD.Twists[Pos] + 3u - SD.Twists[Corner]) % 3u;
+			C |= static_cast<S64>(Corner | (s_Twists[s_Tetrad[Pos]][Twist] << 4)) << (8u * Pos);
+		}
+
+		Edges = E;
+		Corners = C;
+	}
+
+	// Conjugate the solve or position masks with the symmetry
+	void Symmetry::ConjugateMasks(const uint Sym, S64& EMask, S64& CMask)
+	{
+		const SymmetryData& SD = GetData()[Sym];
+		S64 E = 0u, C = 0u;
+
+		for (uint p = 0u; p < 12u; p++)
+			E |= (((EMask >> (4u * p)) & 0xFu) << (4u * SD.Edges[p])) | (((EMask >> (48u + p)) & 0x1u) << (48u + SD.Edges[p]));
+		for (uint p = 0u; p < 8u; p++) C |= ((CMask >> (8u * p)) & 0xFFu) << (8u * SD.Corners[p]);
+
+		EMask = E;
+		CMask = C;
+	}
+
+	// Get the data for all the symmetries
+	const std::array<Symmetry::SymmetryData, 48>& Symmetry::GetData()
+	{
+		static const std::array<SymmetryData, 48> Data = BuildData();
+		return Data;
+	}
+
+	// Build the data for all the symmetries: positions from the spins absolut positions (after the mirror)
+	std::array<Symmetry::SymmetryData, 48> Symmetry::BuildData()
+	{
+		const uint EMirror[12] = { 1u, 0u, 3u, 2u, 4u, 7u, 6u, 5u, 8u, 11u, 10u, 9u }; // FR-FL, BL-BR, UL-UR and DL-DR
+		const uint CMirror[8] = { 1u, 0u, 3u, 2u, 5u, 4u, 7u, 6u }; // UFR-UFL, UBL-UBR, DFR-DFL and DBL-DBR
+
+		std::array<SymmetryData, 48> Data;
+		for (uint Sym = 0u; Sym < SIZE; Sym++)
+		{
+			SymmetryData& SD = Data[Sym];
+			const Spn sp = GetSpin(Sym);
+			SD.Mirror = IsMirror(Sym);
+
+			for (uint p = 0u; p < 12u; p++)
+			{
+				const Aep AbsPos = static_cast<Aep>(SD.Mirror ? EMirror[p] : p);
+				SD.Edges[p] = static_cast<uint8_t>(Cube::GetEdgePosition(AbsPos, sp));
+				SD.Flips[p] = static_cast<uint8_t>((e_Flips[static_cast<int>(sp)] >> p) & 0x1u);
+			}
+			for (uint p = 0u; p < 8u; p++)
+			{
+				const Acp AbsPos = static_cast<Acp>(SD.Mirror ? CMirror[p] : p);
+				SD.Corners[p] = static_cast<uint8_t>(Cube::GetCornerPosition(AbsPos, sp));
+				SD.Twists[p] = s_Tetrad[p] == 1u ? 0u : c_Twists[static_cast<int>(sp)];
+			}
+		}
+
+		// The inverse symmetry has the inverse positions permutation (all the permutations are different)
+		for (uint Sym = 0u; Sym < SIZE; Sym++)
+		{
+			for (uint Inv = 0u; Inv < SIZE; Inv++)
+			{
+				bool IsInverse = true;
+				for (uint p = 0u; p < 12u && IsInverse; p++) IsInverse = Data[Inv].Edges[Data[Sym].Edges[p]] == p;
+				for (uint p = 0u; p < 8u && IsInverse; p++) IsInverse = Data[Inv].Corners[Data[Sym].Corners[p]] == p;
+				if (IsInverse) { Data[Sym].Inverse = static_cast<uint8_t>(Inv); break; }
+			}
+		}
+		return Data;
+	}
+}
@@ -0,0 +1,110 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include "cube_definitions.h"
+#include "cube.h"
+
+namespace grcube3
+{
+	// The 48 symmetries of the cube: the 24 spins (rotations) and the same rotations after a left-right mirror
+	// Conjugating a cube status with a symmetry gives the status reached with the conjugated algorithm (each face turn
+	// replaced by the symmetric turn), so the searches for all the spins can be done with a single cube and a single traversal
+	class Symmetry
+	{
+	public:
+		static constexpr uint SIZE = 48u; // Number of symmetries
+
+		// Get the symmetry index for a spin, with or without left-right mirror
+		static uint GetIndex(const Spn sp, const bool Mirror = false) { return static_cast<uint>(sp) + (Mirror ? 24u : 0u); }
+
+		// Get the spin (rotation) of a symmetry
+		static Spn GetSpin(const uint Sym) { return static_cast<Spn>(Sym % 24u); }
+
+		// Check if a symmetry has a left-right mirror
+		static bool IsMirror(const uint Sym) { return Sym >= 24u; }
+
+		// Get the inverse symmetry (conjugating with a symmetry and then with its inverse gives the original status)
+		static uint GetInverse(const uint Sym) { return GetData()[Sym].Inverse; }
+
+		// Get the symmetric face turn (Stp::NONE to Stp::L2, other steps are returned unchanged)
+		static Stp GetStep(const uint, const Stp);
+
+		// Get the symmetric algorithm (face turns only, other steps are not changed)
+		static Algorithm GetAlgorithm(const uint, const Algorithm&);
+
+		// Conjugate the edges and corners status with the symmetry (cube spin is not changed)
+		static void Conjugate(const uint, S64& Edges, S64& Corners);
+
+		// Conjugate the cube status with the symmetry (cube spin is not changed)
+		static void Conjugate(const uint Sym, Cube& C)
+		{
+			S64 E = C.GetEdgesStatus(), Cr = C.GetCornersStatus();
+			Conjugate(Sym, E, Cr);
+			C.SetStatus(E, Cr);
+		}
+
+		// Get the cube status key as seen from the cube spin (the status conjugated to the default spin)
+		// Cubes with the same scramble applied after different rotations have the same spin normalized key
+		static CubeKey GetSpinNormalizedKey(const Cube& C)
+		{
+			S64 E = C.GetEdgesStatus(), Cr = C.GetCornersStatus();
+			Conjugate(GetInverse(GetIndex(C.GetSpin())), E, Cr);
+			return { E, Cr };
+		}
+
+		// Conjugate the solve or position masks with the symmetry (pieces positions move with the symmetry)
+		// The masks for a spin are the default spin masks conjugated with the spin symmetry
+		// Direction only masks can't be conjugated (the orientation depends on the spin, see Cube::IsOriented)
+		static void ConjugateMasks(const uint, S64& EMask, S64& CMask);
+
+	private:
+		// Pieces permutation and orientation changes for a symmetry
+		struct SymmetryData
+		{
+			std::array<uint8_t, 12> Edges; // Edge position for each edge position (also edge for each edge)
+			std::array<uint8_t, 8> Corners; // Corner position for each corner position (also corner for each corner)
+			std::array<uint8_t, 12> Flips; // Edge direction change for each edge position
+			std::array<uint8_t, 8> Twists; // Corner twist change for each corner position
+			bool Mirror; // Corner twists are inverted
+			uint8_t Inverse; // Inverse symmetry index
+		};
+
+		// Edges direction changes for each spin (positions E slice or M slice for some spins)
+		static const uint16_t e_Flips[24];
+
+		// Corners twist changes for each spin (0 for UFR, UBL, DFL and DBR positions)
+		static const uint8_t c_Twists[24];
+
+		// Left-right mirror for the face turns (Stp::NONE to Stp::L2)
+		static const Stp stp_Mirror[19];
+
+		// Get the data for all the symmetries (built only once)
+		static const std::array<SymmetryData, 48>& GetData();
+		static std::array<SymmetryData, 48> BuildData();
+	};
+}
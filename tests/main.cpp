@@ -0,0 +1,70 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <chrono>
+
+#include "test.h"
+
+namespace grcube3_tests
+{
+	static unsigned int Failures = 0u; // Failed checks in the current test
+
+	std::vector<TestCase>& GetTests()
+	{
+		static std::vector<TestCase> Tests;
+		return Tests;
+	}
+
+	void Fail(const char* File, const int Line, const std::string& Message)
+	{
+		Failures++;
+		std::cout << "\t" << File << ":" << Line << ": check failed: " << Message << std::endl;
+	}
+}
+
+// Run all tests (or only the tests with the given text in his name), must be run from the repository folder so the
+// algorithms collections (algsets folder) are found
+int main(int argc, char** argv)
+{
+	using namespace grcube3_tests;
+
+	const std::string Filter = argc > 1 ? argv[1] : "";
+	unsigned int Run = 0u, Failed = 0u;
+
+	for (const auto& T : GetTests())
+	{
+		if (!Filter.empty() && T.Name.find(Filter) == std::string::npos) continue;
+
+		Failures = 0u;
+		const auto Start = std::chrono::steady_clock::now();
+		std::cout << T.Name << std::endl;
+		T.Function();
+		const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+		std::cout << "\t" << (Failures == 0u ? "OK" : "FAILED") << " (" << Elapsed.count() << " s)" << std::endl;
+
+		Run++;
+		if (Failures > 0u) Failed++;
+	}
+
+	std::cout << Run << " tests run, " << Failed << " failed" << std::endl;
+	return Failed == 0u ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+
+// Minimal test framework for the regression tests: each TEST is registered before main and run by the tests runner
+namespace grcube3_tests
+{
+	typedef void (*TestFunction)();
+
+	struct TestCase // Registered test
+	{
+		std::string Name;
+		TestFunction Function;
+	};
+
+	std::vector<TestCase>& GetTests(); // Registered tests
+	void Fail(const char*, const int, const std::string&); // Report a failed check
+
+	struct TestRegister // Registers a test in his constructor
+	{
+		TestRegister(const char* Name, const TestFunction F) { GetTests().push_back({ Name, F }); }
+	};
+}
+
+#define TEST(Name) \
+	static void Name(); \
+	static const grcube3_tests::TestRegister Name##_Register(#Name, Name); \
+	static void Name()
+
+#define CHECK(Condition) \
+	do { if (!(Condition)) grcube3_tests::Fail(__FILE__, __LINE__, #Condition); } while (false)
+
+#define CHECK_EQUAL(A, B) \
+	do \
+	{ \
+		const auto& a_ = (A); const auto& b_ = (B); \
+		if (!(a_ == b_)) \
+		{ \
+			std::ostringstream m_; \
+			m_ << #A << " == " << #B << " (" << a_ << " != " << b_ << ")"; \
+			grcube3_tests::Fail(__FILE__, __LINE__, m_.str()); \
+		} \
+	} while (false)
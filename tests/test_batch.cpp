@@ -0,0 +1,170 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <random>
+
+#include "test.h"
+#include "cube_batch.h"
+
+using namespace grcube3;
+
+namespace
+{
+	// Cubes with some solved pieces: short random <U, R> or <U, R, F> algorithms (with a rotation for some of them)
+	std::vector<Cube> GetTestCubes(const uint N)
+	{
+		const Stp Steps[] = { Stp::U, Stp::Up, Stp::U2, Stp::R, Stp::Rp, Stp::R2, Stp::F, Stp::Fp, Stp::F2 };
+		const Stp Rotations[] = { Stp::NONE, Stp::NONE, Stp::y, Stp::x2, Stp::zp };
+		std::mt19937 Engine(20u);
+		std::vector<Cube> Cubes;
+
+		for (uint n = 0u; n < N; n++)
+		{
+			Cube C;
+			const uint Length = Engine() % 7u, NumSteps = n % 2u == 0u ? 6u : 9u;
+			for (uint s = 0u; s < Length; s++) C.ApplyStep(Steps[Engine() % NumSteps]);
+			const Stp R = Rotations[Engine() % 5u];
+			if (R != Stp::NONE) C.ApplyStep(R);
+			Cubes.push_back(C);
+		}
+		return Cubes;
+	}
+
+	// Reference check for the solved pieces in a group, piece by piece
+	bool IsSolvedByPieces(const Cube& C, const Pgr G)
+	{
+		std::vector<Pcp> Positions;
+		Cube::AddToPositionsList(G, Positions);
+		for (const auto P : Positions) if (!C.IsSolved(P)) return false;
+		return true;
+	}
+
+	bool SameCube(const Cube& C1, const Cube& C2)
+	{
+		return C1.GetEdgesStatus() == C2.GetEdgesStatus() && C1.GetCornersStatus() == C2.GetCornersStatus() && C1.GetSpin() == C2.GetSpin();
+	}
+}
+
+// The batch checks with the pieces groups masks give the same results as each cube checked piece by piece
+TEST(CubeBatchSolvedPiecesGroups)
+{
+	const std::vector<Cube> Cubes = GetTestCubes(400u);
+	CubeBatch Batch;
+	for (const auto& C : Cubes) Batch.Add(C);
+	CHECK_EQUAL(Batch.GetSize(), static_cast<uint>(Cubes.size()));
+
+	uint SolvedChecks = 0u;
+	for (int g = static_cast<int>(Pgr::ALL); g <= static_cast<int>(Pgr::BELT_RL_4); g++)
+	{
+		const Pgr G = static_cast<Pgr>(g);
+		S64 EMask, CMask;
+		Cube::GetMasksSolved(G, EMask, CMask);
+
+		std::vector<uint8_t> Flags;
+		const uint Solved = Batch.CheckSolved(Flags, EMask, CMask);
+		CHECK_EQUAL(Flags.size(), Cubes.size());
+
+		uint RefSolved = 0u, RefFirst = Batch.GetSize();
+		bool Same = true;
+		for (uint n = 0u; n < Batch.GetSize(); n++)
+		{
+			const bool RefIsSolved = IsSolvedByPieces(Cubes[n], G);
+			if (RefIsSolved) { RefSolved++; if (RefFirst == Batch.GetSize()) RefFirst = n; }
+			if (Batch.IsSolved(n, EMask, CMask) != RefIsSolved || (Flags[n] != 0u) != RefIsSolved || Cubes[n].IsSolved(G) != RefIsSolved) Same = false;
+		}
+		if (!Same) std::cout << "\tPieces group " << g << std::endl;
+		CHECK(Same);
+		CHECK_EQUAL(Solved, RefSolved);
+		CHECK_EQUAL(Batch.FindSolved(EMask, CMask), RefFirst);
+		SolvedChecks += RefSolved;
+	}
+	CHECK(SolvedChecks > 0u); // Some groups solved in some cubes
+}
+
+// The batch checks with the layers masks give the same results as each cube checked piece by piece
+TEST(CubeBatchSolvedLayers)
+{
+	const std::vector<Cube> Cubes = GetTestCubes(400u);
+	const CubeBatch Batch(Cube(), std::vector<CubeDelta>(Cubes.begin(), Cubes.end()));
+	const std::pair<Lyr, Pgr> Layers[] = { { Lyr::U, Pgr::LAYER_U }, { Lyr::D, Pgr::LAYER_D }, { Lyr::F, Pgr::LAYER_F }, { Lyr::B, Pgr::LAYER_B },
+	                                       { Lyr::R, Pgr::LAYER_R }, { Lyr::L, Pgr::LAYER_L }, { Lyr::E, Pgr::LAYER_E }, { Lyr::S, Pgr::LAYER_S },
+	                                       { Lyr::M, Pgr::LAYER_M } };
+
+	for (uint n = 0u; n < Batch.GetSize(); n++) CHECK(SameCube(Batch.GetCube(n), Cubes[n]));
+
+	for (const auto& L : Layers)
+	{
+		S64 EMask, CMask;
+		CHECK(Cube::GetMasksSolved(L.first, EMask, CMask));
+		for (uint n = 0u; n < Batch.GetSize(); n++)
+		{
+			CHECK_EQUAL(Batch.IsSolved(n, EMask, CMask), IsSolvedByPieces(Cubes[n], L.second));
+			CHECK_EQUAL(Cubes[n].IsSolved(L.first), IsSolvedByPieces(Cubes[n], L.second));
+		}
+	}
+}
+
+// Algorithms applied to the batch give the same cubes as the algorithms applied to each cube
+TEST(CubeBatchAlgorithms)
+{
+	const std::vector<Cube> Cubes = GetTestCubes(200u);
+	const std::vector<Algorithm> Algs = { Algorithm("R U R' U R U2 R'"), Algorithm("x' R U' R' D R U R' D' x"), Algorithm("M2 U M U2 M' U M2"),
+	                                      Algorithm("r U R' U' r' F R F' y2"), Algorithm("(R U R' U')3") };
+
+	for (const auto& A : Algs)
+	{
+		CubeBatch Batch;
+		for (const auto& C : Cubes) Batch.Add(C);
+		Batch.ApplyAlgorithm(A);
+
+		for (uint n = 0u; n < Batch.GetSize(); n++)
+		{
+			Cube C = Cubes[n];
+			C.ApplyAlgorithm(A.GetDeveloped()); // Parentheses with repetitions developed
+			CHECK(SameCube(Batch.GetCube(n), C));
+			CHECK_EQUAL(Batch.Find(C), Batch.Find(C.GetEdgesStatus(), C.GetCornersStatus()));
+			CHECK(Batch.Find(C) <= n);
+		}
+	}
+
+	const CubeBatch AlgsBatch(Cubes[1], Algs);
+	for (uint n = 0u; n < AlgsBatch.GetSize(); n++)
+	{
+		Cube C = Cubes[1];
+		C.ApplyAlgorithm(Algs[n].GetDeveloped());
+		CHECK(SameCube(AlgsBatch.GetCube(n), C));
+	}
+
+	// A delta only changes the cubes in his start spin
+	CubeBatch Batch;
+	for (const auto& C : Cubes) Batch.Add(C);
+	const CubeDelta D(Algs[0], Spn::Default);
+	uint Changed = 0u;
+	for (uint n = 0u; n < Cubes.size(); n++) if (Cubes[n].GetSpin() == Spn::Default) Changed++;
+	CHECK_EQUAL(Batch.Apply(D), Changed);
+	for (uint n = 0u; n < Batch.GetSize(); n++)
+	{
+		Cube C = Cubes[n];
+		if (C.GetSpin() == Spn::Default) C.ApplyAlgorithm(Algs[0]);
+		CHECK(SameCube(Batch.GetCube(n), C));
+	}
+}
@@ -0,0 +1,286 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <set>
+#include <tuple>
+
+#include "test.h"
+#include "cube.h"
+#include "deep_search.h"
+
+using namespace grcube3;
+
+namespace
+{
+	typedef std::tuple<S64, S64, Spn> CubeState; // Full cube state (pieces and spin)
+
+	CubeState GetState(const Cube& C) { const CubeKey K = C.GetKey(); return std::make_tuple(K.Edges, K.Corners, C.GetSpin()); }
+
+	// States reached by all the sequences up to the given length
+	void AddAllStates(const std::vector<Stp>& Steps, const Cube& C, const uint Length, std::set<CubeState>& States)
+	{
+		States.insert(GetState(C));
+		if (Length == 0u) return;
+		for (const auto S : Steps)
+		{
+			Cube C2 = C;
+			C2.ApplyStep(S);
+			AddAllStates(Steps, C2, Length - 1u, States);
+		}
+	}
+
+	// Previous search branches filter (opposite steps sorted and no shrinking steps)
+	bool IsShrinkBranch(const Algorithm& A, const Stp S, Algorithm& A2)
+	{
+		if (A.GetSize() > 0u && Algorithm::OppositeSteps(A.Last(), S) && A.Last() > S) return false;
+		A2 = A;
+		return !A2.AppendShrink(S);
+	}
+
+	// States reached with the previous search branches filter, returns the number of sequences
+	uint AddShrinkStates(const std::vector<Stp>& Steps, const Algorithm& A, const uint Length, std::set<CubeState>& States)
+	{
+		States.insert(GetState(Cube(A)));
+		if (Length == 0u) return 1u;
+		uint Sequences = 1u;
+		for (const auto S : Steps)
+		{
+			Algorithm A2;
+			if (IsShrinkBranch(A, S, A2)) Sequences += AddShrinkStates(Steps, A2, Length - 1u, States);
+		}
+		return Sequences;
+	}
+
+	// States reached with the canonical sequences, returns the number of sequences
+	uint AddCanonicalStates(const std::vector<Stp>& Steps, const CanonicalSequences& CS, SearchPath& Path, const Cube& C,
+	                        const uint Length, std::set<CubeState>& States)
+	{
+		States.insert(GetState(C));
+		if (Length == 0u) return 1u;
+		uint Sequences = 1u;
+		for (const auto S : Steps)
+		{
+			if (!Path.IsCanonical(S, CS)) continue;
+			Cube C2 = C;
+			C2.ApplyStep(S);
+			Path.Push(S);
+			Sequences += AddCanonicalStates(Steps, CS, Path, C2, Length - 1u, States);
+			Path.Pop();
+		}
+		return Sequences;
+	}
+
+	uint CountSequences(const uint NumSteps, const uint Length) { return Length == 0u ? 1u : 1u + NumSteps * CountSequences(NumSteps, Length - 1u); }
+
+	// Solves for the first layer (D) with two or more steps found with the previous search branches filter
+	void AddShrinkSolves(const std::vector<Stp>& Steps, const Algorithm& A, const Cube& C, const uint Length, std::vector<Algorithm>& Solves)
+	{
+		if (A.GetSize() >= 2u && C.IsSolved(Pgr::LAYER_D)) Solves.push_back(A);
+		if (Length == 0u) return;
+		for (const auto S : Steps)
+		{
+			Algorithm A2;
+			if (!IsShrinkBranch(A, S, A2)) continue;
+			Cube C2 = C;
+			C2.ApplyStep(S);
+			AddShrinkSolves(Steps, A2, C2, Length - 1u, Solves);
+		}
+	}
+
+	// Solves for the first layer (D) found with a deep search: a double steps root level (as in the methods searches) and single
+	// steps levels up to the given length
+	std::vector<Algorithm> GetDeepSearchSolves(const Sst List, const Algorithm& Scramble, const uint Length)
+	{
+		DeepSearch DS(Scramble);
+		SearchLevel Root, Level;
+		Root.Add(SearchUnit(SequenceTypes::DOUBLE, List));
+		Level.Add(SearchUnit(SequenceTypes::SINGLE, List));
+		DS.AddSearchLevel(Root);
+		for (uint n = 2u; n < Length; n++) DS.AddSearchLevel(Level);
+		DS.AddToMandatoryPieces(Pgr::LAYER_D);
+		DS.UpdateRootData();
+		DS.Run(-1);
+		return DS.GetSolves();
+	}
+
+	// Scramble for the first layer solves made with the given steps
+	Algorithm GetStepsScramble(const std::vector<Stp>& Steps)
+	{
+		Algorithm Scramble;
+		for (uint n = 0u; n < 4u; n++) Scramble.Append(Steps[(7u * n + 2u) % Steps.size()]);
+		Scramble.TransformReverseInvert();
+		return Scramble;
+	}
+
+	// Algorithm form without same-axis reorderings: each run of steps in the same axis is replaced by the state it reaches
+	// (runs with no effect are removed, so the runs around them are joined)
+	std::vector<CubeState> GetSameAxisForm(const Algorithm& A)
+	{
+		std::vector<Stp> Steps;
+		for (uint n = 0u; n < A.GetSize(); n++) Steps.push_back(A.At(n));
+
+		std::vector<CubeState> Form;
+		bool Removed = true;
+		while (Removed)
+		{
+			Removed = false;
+			Form.clear();
+			for (uint First = 0u, Last; First < Steps.size(); First = Last)
+			{
+				Cube C;
+				for (Last = First; Last < Steps.size() && CanonicalSequences::SameAxis(Steps[First], Steps[Last]); Last++) C.ApplyStep(Steps[Last]);
+
+				if (GetState(C) == GetState(Cube()))
+				{
+					Steps.erase(Steps.begin() + First, Steps.begin() + Last);
+					Removed = true;
+					break;
+				}
+				Form.push_back(GetState(C));
+			}
+		}
+		return Form;
+	}
+
+	std::set<std::vector<CubeState>> GetSameAxisForms(const std::vector<Algorithm>& Algs)
+	{
+		std::set<std::vector<CubeState>> Forms;
+		for (const auto& A : Algs) Forms.insert(GetSameAxisForm(A));
+		return Forms;
+	}
+}
+
+// The canonical runs for <r, U, R> (without M) keep the sequences as "R r'", the same states than the previous filter
+TEST(CanonicalSequencesYruRUWithoutSlices)
+{
+	std::vector<Stp> Steps;
+	Algorithm::AddToStepsList(Sst::YRURU_rUR, Steps);
+	const CanonicalSequences& CS = CanonicalSequences::Get(Steps);
+
+	std::set<CubeState> AllStates, ShrinkStates, CanonicalStates;
+	AddAllStates(Steps, Cube(), 4u, AllStates);
+	AddShrinkStates(Steps, Algorithm(), 4u, ShrinkStates);
+	SearchPath Path;
+	AddCanonicalStates(Steps, CS, Path, Cube(), 4u, CanonicalStates);
+
+	CHECK_EQUAL(ShrinkStates.size(), AllStates.size());
+	CHECK_EQUAL(CanonicalStates.size(), AllStates.size());
+	CHECK(CanonicalStates == ShrinkStates);
+
+	SearchPath R;
+	R.Push(Stp::R);
+	CHECK(R.IsCanonical(Stp::rp, CS)); // "R r'" is not "M'" as M is not allowed
+	CHECK(!R.IsCanonical(Stp::rp, CanonicalSequences::Get({ Stp::R, Stp::Rp, Stp::R2, Stp::r, Stp::rp, Stp::r2, Stp::M, Stp::Mp, Stp::M2 })));
+}
+
+// For every steps list used in the searches, the canonical sequences reach all the states reached by the previous filter
+// with less (or the same) sequences
+TEST(CanonicalSequencesAllStepsLists)
+{
+	const Sst Lists[] = { Sst::SINGLE_ALL, Sst::SINGLE_U, Sst::SINGLE_M, Sst::SINGLE_UR, Sst::SINGLE_UM, Sst::LATERAL_UD, Sst::LATERAL_FB,
+	                      Sst::LATERAL_RL, Sst::ROUX_SB, Sst::LATERAL_SINGLE_FBp, Sst::PETRUS_EB, Sst::PETRUS_OR_U, Sst::PETRUS_OR_R,
+	                      Sst::PETRUS_UD_R, Sst::ZZ_LATERAL, Sst::ZZ_LATERAL2, Sst::YRURU_urUR, Sst::YRURU_rUR, Sst::YRURU_UR,
+	                      Sst::NAUTILUS_rRUM };
+
+	for (const auto L : Lists)
+	{
+		std::vector<Stp> Steps;
+		Algorithm::AddToStepsList(L, Steps);
+		const uint Length = Steps.size() > 12u ? 3u : 4u;
+
+		std::set<CubeState> ShrinkStates, CanonicalStates;
+		const uint ShrinkSequences = AddShrinkStates(Steps, Algorithm(), Length, ShrinkStates);
+		SearchPath Path;
+		const uint Sequences = AddCanonicalStates(Steps, CanonicalSequences::Get(Steps), Path, Cube(), Length, CanonicalStates);
+
+		bool AllStates = true;
+		for (const auto& S : ShrinkStates) if (CanonicalStates.find(S) == CanonicalStates.end()) AllStates = false;
+		if (!AllStates) std::cout << "\tSteps list " << static_cast<int>(L) << " loses states" << std::endl;
+		CHECK(AllStates);
+		CHECK(Sequences <= ShrinkSequences);
+		CHECK(Sequences <= CountSequences(static_cast<uint>(Steps.size()), Length));
+	}
+}
+
+// The search nodes drop for the steps lists with same-axis steps in different ranges (wide and slice steps)
+TEST(CanonicalSequencesNodesDrop)
+{
+	const Sst Lists[] = { Sst::YRURU_urUR, Sst::YRURU_rUR, Sst::NAUTILUS_rRUM };
+
+	for (const auto L : Lists)
+	{
+		std::vector<Stp> Steps;
+		Algorithm::AddToStepsList(L, Steps);
+
+		std::set<CubeState> ShrinkStates, CanonicalStates;
+		const uint ShrinkSequences = AddShrinkStates(Steps, Algorithm(), 5u, ShrinkStates);
+		SearchPath Path;
+		const uint Sequences = AddCanonicalStates(Steps, CanonicalSequences::Get(Steps), Path, Cube(), 5u, CanonicalStates);
+
+		std::cout << "\tSteps list " << static_cast<int>(L) << ": " << ShrinkSequences << " -> " << Sequences << " sequences" << std::endl;
+		CHECK(Sequences < ShrinkSequences);
+	}
+}
+
+// For every steps list used in the searches, the deep search solves are the previous filter solves without the same-axis
+// reorderings ("U u" and "u U", "R r R" and "R2 r"...)
+TEST(CanonicalSequencesDeepSearchSolves)
+{
+	const Sst Lists[] = { Sst::SINGLE_ALL, Sst::SINGLE_U, Sst::SINGLE_M, Sst::SINGLE_UR, Sst::SINGLE_UM, Sst::LATERAL_UD, Sst::LATERAL_FB,
+	                      Sst::LATERAL_RL, Sst::ROUX_SB, Sst::LATERAL_SINGLE_FBp, Sst::PETRUS_EB, Sst::PETRUS_OR_U, Sst::PETRUS_OR_R,
+	                      Sst::PETRUS_UD_R, Sst::ZZ_LATERAL, Sst::ZZ_LATERAL2, Sst::YRURU_urUR, Sst::YRURU_rUR, Sst::YRURU_UR,
+	                      Sst::NAUTILUS_rRUM };
+
+	for (const auto L : Lists)
+	{
+		std::vector<Stp> Steps;
+		Algorithm::AddToStepsList(L, Steps);
+		const uint Length = Steps.size() > 12u ? 4u : 5u;
+		const Algorithm Scramble = GetStepsScramble(Steps);
+
+		std::vector<Algorithm> ShrinkSolves;
+		AddShrinkSolves(Steps, Algorithm(), Cube(Scramble), Length, ShrinkSolves);
+		const std::vector<Algorithm> Solves = GetDeepSearchSolves(L, Scramble, Length);
+
+		const bool SameForms = GetSameAxisForms(Solves) == GetSameAxisForms(ShrinkSolves);
+		if (!SameForms) std::cout << "\tSteps list " << static_cast<int>(L) << " has different solves" << std::endl;
+		CHECK(SameForms);
+		CHECK(Solves.size() <= ShrinkSolves.size());
+	}
+}
+
+// With <U, R, u, r> the previous filter finds the same solves in several orders ("U u R' r' u' r R", "u U r' R' u' R r"...)
+TEST(CanonicalSequencesYruRUSolves)
+{
+	std::vector<Stp> Steps;
+	Algorithm::AddToStepsList(Sst::YRURU_urUR, Steps);
+	const Algorithm Scramble = GetStepsScramble(Steps);
+
+	std::vector<Algorithm> ShrinkSolves;
+	AddShrinkSolves(Steps, Algorithm(), Cube(Scramble), 6u, ShrinkSolves);
+	const std::vector<Algorithm> Solves = GetDeepSearchSolves(Sst::YRURU_urUR, Scramble, 6u);
+
+	CHECK_EQUAL(ShrinkSolves.size(), 823u);
+	CHECK_EQUAL(Solves.size(), 115u);
+	CHECK_EQUAL(GetSameAxisForms(ShrinkSolves).size(), 115u);
+	CHECK(GetSameAxisForms(Solves) == GetSameAxisForms(ShrinkSolves));
+}
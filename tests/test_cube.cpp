@@ -0,0 +1,254 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <random>
+#include <set>
+
+#include "test.h"
+#include "cube.h"
+
+using namespace grcube3;
+
+namespace
+{
+	struct ReferenceState // Cube state given by the step by step turns code before the turn tables
+	{
+		S64 Edges, Corners;
+		uint Spin;
+	};
+
+	// Cube starts for the single steps reference states (the second one with other spin)
+	const char* const ReferenceStarts[] = { "R U2 F' L D B2 R' D2 F U' L2 B", "F2 D' L B R2 U F' D2 R L' U B2 z' y" };
+
+	// Reference states: the 54 steps (U to z2) after each start, then 16 sequences of 200 random steps (std::mt19937 with
+	// seed 11, step 1 + n % 54) from the solved cube
+	const ReferenceState ReferenceStates[] =
+	{
+		// R U2 F' L D B2 R' D2 F U' L2 B
+		{ 0x0154A4351820697Bull, 0x0501060324072210ull, 0u },
+		{ 0x0154A4352018697Bull, 0x0501060322102407ull, 0u },
+		{ 0x01A4A4358201697Bull, 0x0501060307122014ull, 0u },
+		{ 0x08A45A430182697Bull, 0x0305010620140712ull, 0u },
+		{ 0x02A4435A0182697Bull, 0x0106030520140712ull, 0u },
+		{ 0x04A435A40182697Bull, 0x0603050120140712ull, 0u },
+		{ 0x01B5A43B01876952ull, 0x0501231220142627ull, 0u },
+		{ 0x01B6A437018B6925ull, 0x0501272620141223ull, 0u },
+		{ 0x00B4A432018569B7ull, 0x0501120720140306ull, 0u },
+		{ 0x01ECA9350682417Bull, 0x2114060325000712ull, 0u },
+		{ 0x05ACA6350982147Bull, 0x0025060314210712ull, 0u },
+		{ 0x01A8A1350482967Bull, 0x1420060301050712ull, 0u },
+		{ 0x012C6435B182097Aull, 0x2001061502140713ull, 0u },
+		{ 0x0125B4356182A970ull, 0x1301060215140720ull, 0u },
+		{ 0x09240435A182B976ull, 0x1201062003140705ull, 0u },
+		{ 0x01A2A4750192638Bull, 0x0516170320110412ull, 0u },
+		{ 0x0384A4950172683Bull, 0x0504110320171612ull, 0u },
+		{ 0x0382A4850132679Bull, 0x0507140320060112ull, 0u },
+		{ 0x08A45A430182697Bull, 0x0305010620140712ull, 1u },
+		{ 0x02A4435A0182697Bull, 0x0106030520140712ull, 3u },
+		{ 0x04A435A40182697Bull, 0x0603050120140712ull, 2u },
+		{ 0x0154A4351820697Bull, 0x0501060324072210ull, 3u },
+		{ 0x0154A4352018697Bull, 0x0501060322102407ull, 1u },
+		{ 0x01A4A4358201697Bull, 0x0501060307122014ull, 2u },
+		{ 0x01ECA9350682417Bull, 0x2114060325000712ull, 21u },
+		{ 0x05ACA6350982147Bull, 0x0025060314210712ull, 17u },
+		{ 0x01A8A1350482967Bull, 0x1420060301050712ull, 4u },
+		{ 0x01B5A43B01876952ull, 0x0501231220142627ull, 17u },
+		{ 0x01B6A437018B6925ull, 0x0501272620141223ull, 21u },
+		{ 0x00B4A432018569B7ull, 0x0501120720140306ull, 4u },
+		{ 0x01A2A4750192638Bull, 0x0516170320110412ull, 10u },
+		{ 0x0384A4950172683Bull, 0x0504110320171612ull, 12u },
+		{ 0x0382A4850132679Bull, 0x0507140320060112ull, 6u },
+		{ 0x012C6435B182097Aull, 0x2001061502140713ull, 12u },
+		{ 0x0125B4356182A970ull, 0x1301060215140720ull, 10u },
+		{ 0x09240435A182B976ull, 0x1201062003140705ull, 6u },
+		{ 0x0254435A1820697Bull, 0x0106030524072210ull, 3u },
+		{ 0x08545A432018697Bull, 0x0305010622102407ull, 1u },
+		{ 0x04A435A48201697Bull, 0x0603050107122014ull, 2u },
+		{ 0x01FEA937068B4125ull, 0x2114272625001223ull, 21u },
+		{ 0x05BDA63B09871452ull, 0x0025231214212627ull, 17u },
+		{ 0x00B8A132048596B7ull, 0x1420120701050306ull, 4u },
+		{ 0x030C6495B172083Aull, 0x2004111502171613ull, 12u },
+		{ 0x0123B4756192A380ull, 0x1316170215110420ull, 10u },
+		{ 0x0B020485A132B796ull, 0x1207142003060105ull, 6u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 10u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 12u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 6u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 1u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 3u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 2u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 21u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 17u },
+		{ 0x01A4A4350182697Bull, 0x0501060320140712ull, 4u },
+		// F2 D' L B R2 U F' D2 R L' U B2 z' y
+		{ 0x07548A64059B2371ull, 0x2217042526030001ull, 18u },
+		{ 0x07540A64859B1372ull, 0x0117042625030022ull, 18u },
+		{ 0x07542A64159B0378ull, 0x2617042211030025ull, 18u },
+		{ 0x05741A74253B8690ull, 0x2514101122071326ull, 18u },
+		{ 0x07521A34257B8960ull, 0x2513071122101426ull, 18u },
+		{ 0x05721A94256B8730ull, 0x2500031122041726ull, 18u },
+		{ 0x0B5441A6259B8370ull, 0x2115270422030026ull, 18u },
+		{ 0x0E54A641259B8370ull, 0x2704211522030026ull, 18u },
+		{ 0x0D54641A259B8370ull, 0x0411251722030026ull, 18u },
+		{ 0x07A41A6459B28370ull, 0x2517041103001612ull, 18u },
+		{ 0x07A41A64B2598370ull, 0x2517041116120300ull, 18u },
+		{ 0x07541A649B258370ull, 0x2517041100262203ull, 18u },
+		{ 0x03501364289BA570ull, 0x1723041105020026ull, 18u },
+		{ 0x07101864239B5A70ull, 0x0205041123170026ull, 18u },
+		{ 0x075815642A9B3870ull, 0x0322041117250026ull, 18u },
+		{ 0x07541A602597834Bull, 0x2517110622032420ull, 18u },
+		{ 0x07541A67259083B4ull, 0x2517202422030611ull, 18u },
+		{ 0x07541A6B25948307ull, 0x2517260022031104ull, 18u },
+		{ 0x05741A74253B8690ull, 0x2514101122071326ull, 19u },
+		{ 0x07521A34257B8960ull, 0x2513071122101426ull, 17u },
+		{ 0x05721A94256B8730ull, 0x2500031122041726ull, 16u },
+		{ 0x07548A64059B2371ull, 0x2217042526030001ull, 17u },
+		{ 0x07540A64859B1372ull, 0x0117042625030022ull, 19u },
+		{ 0x07542A64159B0378ull, 0x2617042211030025ull, 16u },
+		{ 0x07A41A6459B28370ull, 0x2517041103001612ull, 10u },
+		{ 0x07A41A64B2598370ull, 0x2517041116120300ull, 14u },
+		{ 0x07541A649B258370ull, 0x2517041100262203ull, 22u },
+		{ 0x0B5441A6259B8370ull, 0x2115270422030026ull, 14u },
+		{ 0x0E54A641259B8370ull, 0x2704211522030026ull, 10u },
+		{ 0x0D54641A259B8370ull, 0x0411251722030026ull, 22u },
+		{ 0x07541A602597834Bull, 0x2517110622032420ull, 7u },
+		{ 0x07541A67259083B4ull, 0x2517202422030611ull, 1u },
+		{ 0x07541A6B25948307ull, 0x2517260022031104ull, 20u },
+		{ 0x03501364289BA570ull, 0x1723041105020026ull, 1u },
+		{ 0x07101864239B5A70ull, 0x0205041123170026ull, 7u },
+		{ 0x075815642A9B3870ull, 0x0322041117250026ull, 20u },
+		{ 0x07528A34057B2961ull, 0x2213072526101401ull, 17u },
+		{ 0x05740A74853B1692ull, 0x0114102625071322ull, 19u },
+		{ 0x05722A94156B0738ull, 0x2600032211041725ull, 16u },
+		{ 0x0EA4A64159B28370ull, 0x2704211503001612ull, 10u },
+		{ 0x0BA441A6B2598370ull, 0x2115270416120300ull, 14u },
+		{ 0x0D54641A9B258370ull, 0x0411251700262203ull, 22u },
+		{ 0x035013672890A5B4ull, 0x1723202405020611ull, 1u },
+		{ 0x0710186023975A4Bull, 0x0205110623172420ull, 7u },
+		{ 0x0758156B2A943807ull, 0x0322260017251104ull, 20u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 7u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 1u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 20u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 19u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 17u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 16u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 10u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 14u },
+		{ 0x07541A64259B8370ull, 0x2517041122030026ull, 22u },
+		// sequences
+		{ 0x032D7923481650BAull, 0x0004022116232507ull, 12u },
+		{ 0x003F4281635079BAull, 0x1613210527221024ull, 5u },
+		{ 0x08A84609A5B72138ull, 0x1610130724111512ull, 22u },
+		{ 0x0FC379325BA68140ull, 0x0625030022141117ull, 5u },
+		{ 0x0CC67865A942B301ull, 0x1511200217161324ull, 3u },
+		{ 0x0E7A6A49812B3705ull, 0x2506012320022417ull, 10u },
+		{ 0x06EB9286475B310Aull, 0x0327021615240021ull, 10u },
+		{ 0x0DF13850B7A96124ull, 0x2004230712050106ull, 8u },
+		{ 0x08A1095A613482B7ull, 0x2704051100122306ull, 19u },
+		{ 0x0611BA6729483510ull, 0x2117222305000426ull, 10u },
+		{ 0x06AC50276AB14893ull, 0x1623020411251710ull, 18u },
+		{ 0x006965B7A3081942ull, 0x0504122713202126ull, 14u },
+		{ 0x0726035729486AB1ull, 0x2723042511260210ull, 15u },
+		{ 0x0B1C78A0B5643192ull, 0x1713062524101211ull, 6u },
+		{ 0x02FB2418B967A305ull, 0x1117121620041305ull, 16u },
+		{ 0x0627A159026B8743ull, 0x1225170304102611ull, 4u },
+	};
+
+	bool SameState(const Cube& C, const ReferenceState& R)
+	{
+		return C.GetEdgesStatus() == R.Edges && C.GetCornersStatus() == R.Corners && static_cast<uint>(C.GetSpin()) == R.Spin;
+	}
+
+	// Turns code in use (the tests should pass with both: build with -mssse3 and with GRCUBE3_NO_SIMD defined)
+	const char* TurnsCode()
+	{
+#ifdef GRCUBE3_SIMD_TURNS
+		return "SSSE3 shuffles";
+#else
+		return "portable bitfields";
+#endif
+	}
+}
+
+// Every step after two cube starts gives the same state than the step by step turns code
+TEST(CubeStepsReferenceStates)
+{
+	std::cout << "\tTurns code: " << TurnsCode() << std::endl;
+
+	uint n = 0u;
+	for (const auto Start : ReferenceStarts)
+	{
+		for (int s = static_cast<int>(Stp::U); s < static_cast<int>(Stp::PARENTHESIS_OPEN); s++, n++)
+		{
+			Cube C{ Algorithm(Start) };
+			C.ApplyStep(static_cast<Stp>(s));
+			if (!SameState(C, ReferenceStates[n])) std::cout << "\tStep " << s << " after " << Start << std::endl;
+			CHECK(SameState(C, ReferenceStates[n]));
+		}
+	}
+}
+
+// Long random sequences with all steps give the same state than the step by step turns code
+TEST(CubeSequencesReferenceStates)
+{
+	const uint First = 2u * 54u; // First sequence reference state
+	std::mt19937 Engine(11u);
+
+	for (uint n = 0u; n < 16u; n++)
+	{
+		Cube C;
+		for (uint s = 0u; s < 200u; s++) C.ApplyStep(static_cast<Stp>(1u + Engine() % 54u));
+		CHECK(SameState(C, ReferenceStates[First + n]));
+	}
+}
+
+// Slice steps (a single layer turn) give the same state than their two face turns and rotation, in all the spins
+TEST(CubeSliceStepsAsFaceTurns)
+{
+	const std::vector<std::pair<Stp, std::vector<Stp>>> Slices =
+	{
+		{ Stp::E, { Stp::U, Stp::Dp, Stp::yp } }, { Stp::Ep, { Stp::Up, Stp::D, Stp::y } }, { Stp::E2, { Stp::U2, Stp::D2, Stp::y2 } },
+		{ Stp::S, { Stp::Fp, Stp::B, Stp::z } }, { Stp::Sp, { Stp::F, Stp::Bp, Stp::zp } }, { Stp::S2, { Stp::F2, Stp::B2, Stp::z2 } },
+		{ Stp::M, { Stp::R, Stp::Lp, Stp::xp } }, { Stp::Mp, { Stp::Rp, Stp::L, Stp::x } }, { Stp::M2, { Stp::R2, Stp::L2, Stp::x2 } }
+	};
+	const Stp Rotations[] = { Stp::NONE, Stp::x, Stp::x2, Stp::xp, Stp::z, Stp::zp };
+
+	std::set<uint> Spins;
+	for (const auto R1 : Rotations)
+	{
+		for (uint y = 0u; y < 4u; y++)
+		{
+			Cube Start{ Algorithm("R U2 F' L D B2 R' D2 F U' L2 B") };
+			if (R1 != Stp::NONE) Start.ApplyStep(R1);
+			for (uint n = 0u; n < y; n++) Start.ApplyStep(Stp::y);
+			Spins.insert(static_cast<uint>(Start.GetSpin()));
+
+			for (const auto& S : Slices)
+			{
+				Cube C1 = Start, C2 = Start;
+				C1.ApplyStep(S.first);
+				for (const auto F : S.second) C2.ApplyStep(F);
+				CHECK(C1.GetEdgesStatus() == C2.GetEdgesStatus() && C1.GetCornersStatus() == C2.GetCornersStatus() && C1.GetSpin() == C2.GetSpin());
+			}
+		}
+	}
+	CHECK_EQUAL(Spins.size(), 24u);
+}
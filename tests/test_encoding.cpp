@@ -0,0 +1,105 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <cstdint>
+
+#include "test.h"
+#include "algorithm.h"
+
+using namespace grcube3;
+
+namespace
+{
+	// Algorithms with usual steps, escaped steps (wide, slice and rotation steps, parentheses) and lengths that fill whole bytes
+	const char* const EncodingAlgorithms[] =
+	{
+		"",
+		"R U R' U'",
+		"R U R' U' R' F R2 U' R' U' R U R' F'",
+		"(R U R' U')2 y' F' u r' M2 E S' z2",
+		"x2 D' R2 U R' u2 (L F' L' F)3 b d' l2 f",
+		"U U U U U U U U",
+		"M",
+		"R U R' U R U2 R' (U)",
+	};
+}
+
+// Packed algorithms concatenated in the same buffer are split with the used bytes of each one
+TEST(PackedAlgorithmsConcatenated)
+{
+	std::vector<uint8_t> Buffer;
+	std::vector<size_t> Positions;
+	for (const auto Text : EncodingAlgorithms)
+	{
+		Positions.push_back(Buffer.size());
+		Algorithm(Text).GetPacked(Buffer);
+	}
+	Positions.push_back(Buffer.size());
+
+	size_t Position = 0u;
+	for (uint n = 0u; n < sizeof(EncodingAlgorithms) / sizeof(EncodingAlgorithms[0]); n++)
+	{
+		Algorithm A;
+		size_t Used = 0u;
+		CHECK(A.AppendPacked(Buffer.data() + Position, Buffer.size() - Position, Used));
+		CHECK(A == Algorithm(EncodingAlgorithms[n]));
+		CHECK_EQUAL(Position + Used, Positions[n + 1u]);
+		Position += Used;
+	}
+	CHECK_EQUAL(Position, Buffer.size());
+}
+
+// Packed algorithms without end code (truncated) are not valid and nothing is appended
+TEST(PackedAlgorithmsTruncated)
+{
+	for (const auto Text : EncodingAlgorithms)
+	{
+		std::vector<uint8_t> Buffer;
+		Algorithm(Text).GetPacked(Buffer);
+
+		for (size_t Size = 0u; Size < Buffer.size(); Size++)
+		{
+			Algorithm A("R");
+			size_t Used = 0u;
+			CHECK(!A.AppendPacked(Buffer.data(), Size, Used)); // The last byte always has bits of the end code
+			CHECK(A == Algorithm("R"));
+		}
+	}
+}
+
+// One byte per step round trip
+TEST(BytesAlgorithms)
+{
+	for (const auto Text : EncodingAlgorithms)
+	{
+		std::vector<uint8_t> Buffer;
+		Algorithm(Text).GetBytes(Buffer);
+
+		Algorithm A;
+		CHECK(A.AppendBytes(Buffer.data(), Buffer.size()));
+		CHECK(A == Algorithm(Text));
+	}
+	const uint8_t NotValid[] = { 1u, 200u };
+	Algorithm A;
+	CHECK(!A.AppendBytes(NotValid, 2u));
+	CHECK_EQUAL(A.GetSize(), 0u);
+}
@@ -0,0 +1,87 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <random>
+
+#include "test.h"
+#include "algorithm.h"
+
+using namespace grcube3;
+
+namespace
+{
+	const Metrics AllMetrics[] = { Metrics::Movements, Metrics::HTM, Metrics::QTM, Metrics::STM, Metrics::QSTM, Metrics::ETM,
+	                               Metrics::ATM, Metrics::PTM, Metrics::HTM15, Metrics::OBTM };
+
+	// Returns the number of metrics where the single metric is not the same as in all the metrics
+	uint CompareMetrics(const Algorithm& A)
+	{
+		const AlgorithmMetrics AM = A.GetMetrics();
+		uint Differences = 0u;
+		for (const auto M : AllMetrics) if (A.GetMetric(M) != AM.Get(M)) Differences++;
+		return Differences;
+	}
+}
+
+// Single metrics for algorithms with parentheses are the metrics of the developed algorithm
+TEST(MetricsWithParentheses)
+{
+	const char* const Algorithms[] =
+	{
+		"R U R' U'",
+		"(R U R' U')2 M2",
+		"(R U2 (R' F)2)3 u' y",
+		"(R U R' U') (F R U R' U' F')",
+		"(U R U' L' U R' U' L)2 U",
+		"D U R L' (U D')2",
+	};
+
+	for (const auto Text : Algorithms)
+	{
+		const Algorithm A(Text), ADev = A.GetDeveloped();
+		for (const auto M : AllMetrics) CHECK_EQUAL(A.GetMetric(M), ADev.GetMetric(M));
+		CHECK_EQUAL(CompareMetrics(A), 0u);
+	}
+
+	const Algorithm A("(R U2 (R' F)2)3 M2");
+	CHECK_EQUAL(A.GetHTM(), 20u);
+	CHECK_EQUAL(A.GetQTM(), 25u);
+	CHECK_EQUAL(A.GetSTM(), 19u);
+	CHECK_EQUAL(A.Get15HTM(), 22.5f);
+}
+
+// Single metrics and all the metrics for random steps, with empty steps and parentheses (valid or not)
+TEST(MetricsRandomSteps)
+{
+	std::mt19937 Engine(2026u);
+	std::uniform_int_distribution<int> StepDistr(0, static_cast<int>(Stp::PARENTHESIS_CLOSE_9_REP)), LengthDistr(0, 24);
+	uint Differences = 0u;
+
+	for (uint n = 0u; n < 50000u; n++)
+	{
+		Algorithm A;
+		const int Length = LengthDistr(Engine);
+		for (int s = 0; s < Length; s++) A.Append(static_cast<Stp>(StepDistr(Engine)));
+		Differences += CompareMetrics(A);
+	}
+	CHECK_EQUAL(Differences, 0u);
+}
@@ -0,0 +1,179 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <fstream>
+#include <random>
+
+#include "test.h"
+#include "algorithm.h"
+
+using namespace grcube3;
+
+namespace
+{
+	// Previous text parser (CleanString, CheckParentheses and the steps tokenizer), the reference for Append
+	bool AppendPrevious(const std::string& Text, std::vector<Stp>& Steps)
+	{
+		const std::string s = Algorithm::CleanString(Text);
+		if (s.length() == 0u || !Algorithm::CheckParentheses(s)) return false;
+
+		const std::string Letters = "UDFBRLudfbrlESMxyz";
+		for (size_t pos = 0u; pos < s.length(); pos++)
+		{
+			const size_t l = Letters.find(s[pos]);
+			const char Next = pos + 1u < s.length() ? s[pos + 1u] : '\0';
+			if (l != std::string::npos)
+			{
+				int S = 1 + 3 * static_cast<int>(l); // Steps groups in the same order than the letters
+				if (Next == '\'') { S += 1; pos++; }
+				else if (Next == '2') { S += 2; pos++; }
+				Steps.push_back(static_cast<Stp>(S));
+			}
+			else if (s[pos] == '(') Steps.push_back(Stp::PARENTHESIS_OPEN);
+			else if (s[pos] == ')')
+			{
+				if (Next >= '2' && Next <= '9')
+				{
+					Steps.push_back(static_cast<Stp>(static_cast<int>(Stp::PARENTHESIS_OPEN) + Next - '0'));
+					pos++;
+				}
+				else Steps.push_back(Stp::PARENTHESIS_CLOSE_1_REP);
+			}
+		}
+		return true;
+	}
+
+	// Expected parse error and position in the text for a text not valid for the previous parser
+	Ape GetPreviousError(const std::string& Text, size_t& ErrorPos)
+	{
+		ErrorPos = 0u;
+		if (Algorithm::CleanString(Text).empty()) return Ape::EMPTY;
+
+		std::vector<size_t> Opens; // Positions of the open parentheses not closed
+		for (size_t pos = 0u; pos < Text.length(); pos++)
+		{
+			if (Text[pos] == '(') Opens.push_back(pos);
+			else if (Text[pos] == ')')
+			{
+				if (Opens.empty())
+				{
+					ErrorPos = pos;
+					return Ape::CLOSE_WITHOUT_OPEN;
+				}
+				Opens.pop_back();
+			}
+		}
+		if (!Opens.empty())
+		{
+			ErrorPos = Opens.front(); // Outer open parenthesis
+			return Ape::OPEN_WITHOUT_CLOSE;
+		}
+		return Ape::NONE;
+	}
+
+	// Compare the parser with the previous one for the given text, false if there are differences
+	bool CheckText(const std::string& Text)
+	{
+		std::vector<Stp> Previous;
+		const bool PreviousValid = AppendPrevious(Text, Previous);
+
+		Algorithm A("R"); // The steps must be appended
+		size_t ErrorPos = 0u;
+		const Ape Error = A.Append(Text.data(), Text.length(), ErrorPos);
+
+		if (PreviousValid)
+		{
+			if (Error != Ape::NONE || A.GetSize() != Previous.size() + 1u) return false;
+			for (uint n = 0u; n < Previous.size(); n++) if (A[n + 1u] != Previous[n]) return false;
+			return true;
+		}
+
+		size_t PreviousErrorPos;
+		const Ape PreviousError = GetPreviousError(Text, PreviousErrorPos);
+		return Error == PreviousError && ErrorPos == PreviousErrorPos && A.GetSize() == 1u && A[0] == Stp::R;
+	}
+}
+
+// The algorithms in the collections files are parsed as with the previous parser
+TEST(ParserAlgorithmsCollections)
+{
+	const char* const Files[] = { "1LLL", "2GLL", "6CO", "6CP", "APDR", "CDRLL", "CMLL", "COLL", "DCAL", "EODF", "EOLE", "EPLL", "JTLE",
+	                              "L5E", "L5EP", "NCLL", "NCOLL", "OCLL", "OLL", "PLL", "TDR", "TNCLL", "ZBLL", "cancel2", "cancel3" };
+	uint Texts = 0u;
+
+	for (const auto F : Files)
+	{
+		std::ifstream File(std::string("algsets/") + F + ".xml");
+		CHECK(File.good()); // The tests must be run from the repository folder
+		const std::string Content((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+		const std::string Open = "<Algorithm>", Close = "</Algorithm>";
+		for (size_t pos = Content.find(Open); pos != std::string::npos; pos = Content.find(Open, pos))
+		{
+			pos += Open.length();
+			const std::string Text = Content.substr(pos, Content.find(Close, pos) - pos);
+			if (!CheckText(Text)) std::cout << "\t" << F << ": " << Text << std::endl;
+			CHECK(CheckText(Text));
+			Texts++;
+		}
+	}
+	CHECK(Texts > 6000u);
+}
+
+// Some texts with the parse rules and errors
+TEST(ParserRulesAndErrors)
+{
+	const char* const Texts[] = { "", "   ", "w", "2'", "R2' U'2 Rw Uw2' X Y' Z2", "(R U R' U')3 (M' U)4", "R U)", "((R U) (R' U')", "(R) (U", "R ( U ( R' ) U'",
+	                              "a#R U@ w", "))((", "Lw' Dw2 Fw Bw'2", "R''", "R22'", "()9", ")R(", "R U R' U R U2 R'" };
+	for (const auto T : Texts)
+	{
+		if (!CheckText(T)) std::cout << "\t\"" << T << "\"" << std::endl;
+		CHECK(CheckText(T));
+	}
+
+	size_t ErrorPos = 0u;
+	Algorithm A;
+	CHECK(A.Append("R U) F", 6u, ErrorPos) == Ape::CLOSE_WITHOUT_OPEN);
+	CHECK_EQUAL(ErrorPos, 3u);
+	CHECK(A.Append("R (U (F) (", 10u, ErrorPos) == Ape::OPEN_WITHOUT_CLOSE);
+	CHECK_EQUAL(ErrorPos, 2u);
+	CHECK(A.Append(" ", 1u, ErrorPos) == Ape::EMPTY);
+	CHECK_EQUAL(A.GetSize(), 0u);
+}
+
+// Random texts with the allowed chars, spaces, 'w', apostrophes, digits, parentheses and some not allowed chars
+TEST(ParserRandomTexts)
+{
+	const std::string Chars = "UDFBRLudfbrlESMxyzXYZw''''2222223456789((()))      a#";
+	std::mt19937 Engine(23u);
+	uint Differences = 0u;
+
+	for (uint n = 0u; n < 200000u; n++)
+	{
+		std::string Text;
+		const uint Length = Engine() % 16u;
+		for (uint c = 0u; c < Length; c++) Text.push_back(Chars[Engine() % Chars.length()]);
+
+		if (!CheckText(Text) && Differences++ < 5u) std::cout << "\t\"" << Text << "\"" << std::endl;
+	}
+	CHECK_EQUAL(Differences, 0u);
+}
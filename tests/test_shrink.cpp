@@ -0,0 +1,136 @@
+/*  This file is part of "GR Cube"
+
+	Copyright (C) 2022 German Ramos Rodriguez
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	German Ramos Rodriguez
+	Vigo, Spain
+	<mailto:grvigo@hotmail.com>
+*/
+
+#include <random>
+
+#include "test.h"
+#include "algorithm.h"
+
+using namespace grcube3;
+
+namespace
+{
+	// Shrink loop result, the reference for ShrinkAll
+	Algorithm ShrinkLoop(Algorithm A) { while (A.Shrink()); return A; }
+
+	// ShrinkAll result
+	Algorithm ShrinkSinglePass(Algorithm A) { A.ShrinkAll(); return A; }
+
+	// Compare ShrinkAll and the Shrink loop for random sequences of the given steps, returns the number of differences
+	uint CompareRandomShrinks(const std::vector<Stp>& Steps, const uint Sequences, const uint MaxLength, std::mt19937& Engine)
+	{
+		std::uniform_int_distribution<uint> StepDistr(0u, static_cast<uint>(Steps.size()) - 1u), LengthDistr(0u, MaxLength);
+		uint Differences = 0u;
+
+		for (uint n = 0u; n < Sequences; n++)
+		{
+			Algorithm A;
+			const uint Length = LengthDistr(Engine);
+			for (uint s = 0u; s < Length; s++) A.Append(Steps[StepDistr(Engine)]);
+
+			const Algorithm Loop = ShrinkLoop(A), SinglePass = ShrinkSinglePass(A);
+			if (!(Loop == SinglePass))
+			{
+				if (Differences++ < 5u) std::cout << "\t" << A.ToString() << ": " << Loop.ToString() << " / " << SinglePass.ToString() << std::endl;
+			}
+		}
+		return Differences;
+	}
+}
+
+// A join that appears after a middle slice step is joined (the Shrink loop finds it in the next round)
+TEST(ShrinkAllJoinsAfterSliceJoin)
+{
+	const Algorithm A("D2 d E' U' U' E2 D' U D2 D' U' d U d");
+
+	CHECK_EQUAL(ShrinkSinglePass(A).ToString(), ShrinkLoop(A).ToString());
+	CHECK_EQUAL(ShrinkSinglePass(A).ToString(), std::string("D2 d E' U2 E2 U d2"));
+	CHECK_EQUAL(ShrinkSinglePass(Algorithm("U R R' U")).ToString(), std::string("U2"));
+	CHECK_EQUAL(ShrinkSinglePass(Algorithm("R L R' L'")).ToString(), std::string(""));
+}
+
+// Random sequences around the U/D axis with face, wide, slice and rotation steps (most joins and alternate joins)
+TEST(ShrinkAllRandomUDAxis)
+{
+	const std::vector<Stp> Steps = { Stp::U, Stp::Up, Stp::U2, Stp::D, Stp::Dp, Stp::D2, Stp::u, Stp::up, Stp::u2, Stp::d, Stp::dp,
+	                                 Stp::d2, Stp::E, Stp::Ep, Stp::E2, Stp::y, Stp::yp, Stp::y2 };
+	std::mt19937 Engine(2024u);
+
+	CHECK_EQUAL(CompareRandomShrinks(Steps, 100000u, 16u, Engine), 0u);
+}
+
+// Random sequences with all steps, and with few steps in all axes to have more joins
+TEST(ShrinkAllRandomAllSteps)
+{
+	std::vector<Stp> Steps;
+	for (int s = static_cast<int>(Stp::U); s < static_cast<int>(Stp::PARENTHESIS_OPEN); s++) Steps.push_back(static_cast<Stp>(s));
+	std::mt19937 Engine(2025u);
+
+	CHECK_EQUAL(CompareRandomShrinks(Steps, 50000u, 24u, Engine), 0u);
+
+	const std::vector<Stp> FewSteps = { Stp::U, Stp::Up, Stp::D2, Stp::r, Stp::M, Stp::Rp, Stp::L, Stp::x, Stp::F, Stp::S, Stp::bp, Stp::z2 };
+	CHECK_EQUAL(CompareRandomShrinks(FewSteps, 50000u, 24u, Engine), 0u);
+}
+
+// Full solves from the CFOP, Roux and LBL methods (steps groups concatenated, with cancellations between them)
+TEST(ShrinkAllMethodsSolves)
+{
+	const std::vector<std::pair<std::string, uint>> Solves = // Solve and size after shrink
+	{
+		{ "z2 L2 B L F' R U' R' U' R U R' L' U L B' U B U' R' U2 R F U F' U R' U2 R y R' U' R' F R F' U R R' U2 R U2 R' F R U R' U' R' F' R2 U2", 49u }, // CFOP
+		{ "x B' D B L D2 B U L U' L' U2 F U2 F' R' U R B' U2 B R' U R F' U' F R' U' R U F' U2 F U' F' U F R U2 R' U' R U' R' R U R' y' R2 u' R U' R' U R' u R2 U'", 53u }, // CFOP
+		{ "z R' F U R' F' B2 F U2 F' L U' L' B U B' L U L' U B' U B L U L' y2 R' U' F U R U' R' F' R R' U2 R U R' U2 L U' R U L'", 43u }, // CFOP
+		{ "z2 U2 F L' D' F' B' R B R B U B' U2 B U' B' R' U' R' F R F' R U' R' U2 R M' U' M U2 M U M' U' U2 M' U2 M' U M2 U' U2 M U2 M'", 45u }, // Roux
+		{ "(D) (R F) (U' R2) (L' B L) (F' U2 F) (U R' U' R) (U' L U2 L') (U L' U' L) (U' L' U L U F U' F') (B U' B' U' R' U R) (B' U2 B U2 L U L') "
+		  "(F' U F U' R U2 R' U2 R U' R') (F R U R' U' F') U' (F R U R' U' F') U2 (R' U' R U' R' U2 R U') U2", 78u }, // LBL
+		{ "(D') (L F' L') (D' R D) (R' U R L U' L') (L' U' L) (R' U2 R B U B') (U R' U' R U B U B') (U R U R' U' F' U' F) (U L' U' L U F U F') "
+		  "(U L U L' U' B' U' B) U (F R U R' U' F')2 U' (R' U' R U' R' U2 R U') U (U R U' L' U R' U' L) U' (U R U' L' U R' U' L) U", 88u }, // LBL
+		{ "(B2) (F' L) (L F' L') (L U L') (F U' F' R' U2 R) (L' U2 L F U F') (L U L' U' B' U' B) (U' L' U' L U F U F') (F' U' F U R U R') "
+		  "(R' U' R U' R' U2 R U') U2 (R' U' R U' R' U2 R U') U'", 54u }, // LBL
+		{ "z2 (R) (L B) (U F' L) (U' R' F R) (U R' U2 R) (R U2 R') (B' U B) (F U2 F' L' U' L) (L' U2 L U2 F U F') (R' U2 R U2 B U B') "
+		  "(F' U2 F U2 R U R') (L U L' U' B' U' B) U' (F R U R' U' F')2 U' U' (U R U' L' U R' U' L)2 U", 79u } // LBL
+	};
+
+	for (const auto& Solve : Solves)
+	{
+		const Algorithm A = Algorithm(Solve.first).GetDeveloped();
+
+		CHECK_EQUAL(ShrinkSinglePass(A).ToString(), ShrinkLoop(A).ToString());
+		CHECK_EQUAL(ShrinkSinglePass(A).GetSize(), Solve.second);
+	}
+}
+
+// Nested cancellations (the Shrink loop needs a round for each level)
+TEST(ShrinkAllNestedCancellations)
+{
+	const std::vector<Stp> Steps = { Stp::U, Stp::R, Stp::F, Stp::L, Stp::B, Stp::D, Stp::E, Stp::r };
+	Algorithm A;
+	for (uint n = 0u; n < 1000u; n++) A.Append(Steps[n % Steps.size()]);
+	Algorithm Inverse = A;
+	Inverse.TransformReverseInvert();
+	A += Inverse;
+
+	CHECK_EQUAL(ShrinkSinglePass(A).GetSize(), 0u);
+
+	A.Insert(1000u, Stp::U2);
+	CHECK_EQUAL(ShrinkSinglePass(A).ToString(), ShrinkLoop(A).ToString());
+}
@@ -0,0 +1,50 @@
+# Regression tests for the algorithm, cube and search code (console application without Qt)
+# Run the tests from the repository folder, so the algorithms collections (algsets folder) are found: tests/ssmaster_tests
+
+QT -= core gui
+
+CONFIG += console c++14
+CONFIG -= app_bundle
+
+TEMPLATE = app
+TARGET = ssmaster_tests
+
+QMAKE_CXXFLAGS_RELEASE -= -O
+QMAKE_CXXFLAGS_RELEASE -= -O1
+QMAKE_CXXFLAGS_RELEASE -= -O2
+QMAKE_CXXFLAGS_RELEASE += -O3
+
+# The cube tests check the turns code in use: build them with and without SSSE3 shuffles (see SSMaster.pro)
+#QMAKE_CXXFLAGS_RELEASE += -mssse3
+#DEFINES += GRCUBE3_NO_SIMD
+
+INCLUDEPATH += ..
+
+LIBS += -lpthread
+
+SOURCES += \
+    main.cpp \
+    test_batch.cpp \
+    test_canonical.cpp \
+    test_cube.cpp \
+    test_encoding.cpp \
+    test_metrics.cpp \
+    test_parser.cpp \
+    test_shrink.cpp \
+    ../algorithm.cpp \
+    ../collection.cpp \
+    ../coordinates.cpp \
+    ../corners.cpp \
+    ../cube.cpp \
+    ../cube_batch.cpp \
+    ../cube_delta.cpp \
+    ../deep_eval.cpp \
+    ../deep_search.cpp \
+    ../edges.cpp \
+    ../pruning.cpp \
+    ../search_stats.cpp \
+    ../symmetry.cpp \
+    ../tinyxml2.cpp
+
+HEADERS += \
+    test.h
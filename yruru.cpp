@@ -800,7 +800,7 @@ namespace grcube3
 					if (Algorithm::IsTurn(Lines[sp][n].Last()))
 					{
 						CPLines[sp][n].Insert(0u, Lines[sp][n].Last());
-						while (CPLines[sp][n].Shrink());
+						CPLines[sp][n].ShrinkAll();
 						Lines[sp][n].EraseLast();
 					}
 				}
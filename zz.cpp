@@ -703,7 +703,7 @@ namespace grcube3
                 if (Algorithm::IsTurn(EOX[sp][n].Last()))
                 {
                     F2L_1[sp][n].Insert(0u, EOX[sp][n].Last());
-                    while (F2L_1[sp][n].Shrink());
+                    F2L_1[sp][n].ShrinkAll();
                     EOX[sp][n].EraseLast();
                 }
 
@@ -714,26 +714,26 @@ namespace grcube3
                         if (!AlgZBLL[sp].empty())
                         {
                             AlgZBLL[sp][n].Insert(0u, F2L_1[sp][n].Last());
-                            while (AlgZBLL[sp][n].Shrink());
+                            AlgZBLL[sp][n].ShrinkAll();
                             F2L_1[sp][n].EraseLast();
                         }
                         else if (!AlgOCLL[sp].empty())
                         {
                             AlgOCLL[sp][n].Insert(0u, F2L_1[sp][n].Last());
-                            while (AlgOCLL[sp][n].Shrink());
+                            AlgOCLL[sp][n].ShrinkAll();
                             F2L_1[sp][n].EraseLast();
                         }
                         else if (!AlgCOLL[sp].empty())
                         {
                             AlgCOLL[sp][n].Insert(0u, F2L_1[sp][n].Last());
-                            while (AlgCOLL[sp][n].Shrink());
+                            AlgCOLL[sp][n].ShrinkAll();
                             F2L_1[sp][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_2[sp][n].Insert(0u, F2L_1[sp][n].Last());
-                        while (F2L_2[sp][n].Shrink());
+                        F2L_2[sp][n].ShrinkAll();
                         F2L_1[sp][n].EraseLast();
                     }
                 }
@@ -745,26 +745,26 @@ namespace grcube3
                         if (!AlgZBLL[sp].empty())
                         {
                             AlgZBLL[sp][n].Insert(0u, F2L_2[sp][n].Last());
-                            while (AlgZBLL[sp][n].Shrink());
+                            AlgZBLL[sp][n].ShrinkAll();
                             F2L_2[sp][n].EraseLast();
                         }
                         else if (!AlgOCLL[sp].empty())
                         {
                             AlgOCLL[sp][n].Insert(0u, F2L_2[sp][n].Last());
-                            while (AlgOCLL[sp][n].Shrink());
+                            AlgOCLL[sp][n].ShrinkAll();
                             F2L_2[sp][n].EraseLast();
                         }
                         else if (!AlgCOLL[sp].empty())
                         {
                             AlgCOLL[sp][n].Insert(0u, F2L_2[sp][n].Last());
-                            while (AlgCOLL[sp][n].Shrink());
+                            AlgCOLL[sp][n].ShrinkAll();
                             F2L_2[sp][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_3[sp][n].Insert(0u, F2L_2[sp][n].Last());
-                        while (F2L_3[sp][n].Shrink());
+                        F2L_3[sp][n].ShrinkAll();
                         F2L_2[sp][n].EraseLast();
                     }
                 }
@@ -776,26 +776,26 @@ namespace grcube3
                         if (!AlgZBLL[sp].empty())
                         {
                             AlgZBLL[sp][n].Insert(0u, F2L_3[sp][n].Last());
-                            while (AlgZBLL[sp][n].Shrink());
+                            AlgZBLL[sp][n].ShrinkAll();
                             F2L_3[sp][n].EraseLast();
                         }
                         else if (!AlgOCLL[sp].empty())
                         {
                             AlgOCLL[sp][n].Insert(0u, F2L_3[sp][n].Last());
-                            while (AlgOCLL[sp][n].Shrink());
+                            AlgOCLL[sp][n].ShrinkAll();
                             F2L_3[sp][n].EraseLast();
                         }
                         else if (!AlgCOLL[sp].empty())
                         {
                             AlgCOLL[sp][n].Insert(0u, F2L_3[sp][n].Last());
-                            while (AlgCOLL[sp][n].Shrink());
+                            AlgCOLL[sp][n].ShrinkAll();
                             F2L_3[sp][n].EraseLast();
                         }
                     }
                     else
                     {
                         F2L_4[sp][n].Insert(0u, F2L_3[sp][n].Last());
-                        while (F2L_4[sp][n].Shrink());
+                        F2L_4[sp][n].ShrinkAll();
                         F2L_3[sp][n].EraseLast();
                     }
                 }
@@ -805,19 +805,19 @@ namespace grcube3
                     if (!AlgZBLL[sp].empty())
                     {
                         AlgZBLL[sp][n].Insert(0u, F2L_4[sp][n].Last());
-                        while (AlgZBLL[sp][n].Shrink());
+                        AlgZBLL[sp][n].ShrinkAll();
                         F2L_4[sp][n].EraseLast();
                     }
                     else if (!AlgOCLL[sp].empty())
                     {
                         AlgOCLL[sp][n].Insert(0u, F2L_4[sp][n].Last());
-                        while (AlgOCLL[sp][n].Shrink());
+                        AlgOCLL[sp][n].ShrinkAll();
                         F2L_4[sp][n].EraseLast();
                     }
                     else if (!AlgCOLL[sp].empty())
                     {
                         AlgCOLL[sp][n].Insert(0u, F2L_4[sp][n].Last());
-                        while (AlgCOLL[sp][n].Shrink());
+                        AlgCOLL[sp][n].ShrinkAll();
                         F2L_4[sp][n].EraseLast();
                     }
                 }
@@ -948,6 +948,7 @@ namespace grcube3
         Report += "Last layer time: " + std::to_string(GetTimeLL()) + " s\n";
         Report += "Threads: " + std::to_string(GetUsedCores() > 0 ? GetUsedCores() : DeepSearch::GetSystemCores()) +
                   " of " + std::to_string(DeepSearch::GetSystemCores()) + "\n";
+        Report += GetSearchStatsReport(); // Only with search statistics enabled
 
         return Report;
     }